@@ -170,6 +170,71 @@ _Py_bit_length(unsigned long x)
 }
 
 
+// Return the index of the least significant 1 bit in 'x', which must not be
+// zero.
+static inline int
+_Py_ctz32(uint32_t x)
+{
+    assert(x != 0);
+#if (defined(__clang__) || defined(__GNUC__))
+    Py_BUILD_ASSERT(sizeof(x) <= sizeof(unsigned int));
+    return __builtin_ctz(x);
+#elif defined(_MSC_VER)
+    unsigned long lsb;
+    _BitScanForward(&lsb, x);
+    return (int)lsb;
+#else
+    int lsb = 0;
+    while (!(x & 1)) {
+        lsb++;
+        x >>= 1;
+    }
+    return lsb;
+#endif
+}
+
+
+// Return the number of leading zero bits in 'x', which must not be zero.
+static inline int
+_Py_clz64(uint64_t x)
+{
+    assert(x != 0);
+#if (defined(__clang__) || defined(__GNUC__))
+    Py_BUILD_ASSERT(sizeof(x) <= sizeof(unsigned long long));
+    return __builtin_clzll(x);
+#else
+    uint32_t high = (uint32_t)(x >> 32);
+    if (high != 0) {
+        return 32 - _Py_bit_length(high);
+    }
+    return 64 - _Py_bit_length((uint32_t)x);
+#endif
+}
+
+
+// Return the low 64 bits of the 128-bit product a * b and store the high
+// 64 bits in *high.
+static inline uint64_t
+_Py_umul128(uint64_t a, uint64_t b, uint64_t *high)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128)a * b;
+    *high = (uint64_t)(product >> 64);
+    return (uint64_t)product;
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, high);
+#else
+    uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    uint64_t b00 = a_lo * b_lo;
+    uint64_t mid1 = a_hi * b_lo + (b00 >> 32);
+    uint64_t mid2 = a_lo * b_hi + (uint32_t)mid1;
+    *high = a_hi * b_hi + (mid1 >> 32) + (mid2 >> 32);
+    return (mid2 << 32) | (uint32_t)b00;
+#endif
+}
+
+
 #ifdef __cplusplus
 }
 #endif
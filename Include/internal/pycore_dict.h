@@ -89,6 +89,22 @@ struct _dictkeysobject {
 #define DK_ENTRIES(dk) \
     ((PyDictKeyEntry*)(&((int8_t*)((dk)->dk_indices))[DK_SIZE(dk) * DK_IXSIZE(dk)]))
 
+/* The values of a split table follow the order of the shared keys, with
+   NULL for the keys the dict doesn't have.  Return 1 if the empty slot ix
+   of the split table mp can be filled without breaking insertion order,
+   that is if no value follows it. */
+static inline int
+_PyDict_SplitSlotInOrder(PyDictObject *mp, Py_ssize_t ix)
+{
+    assert(mp->ma_values != NULL && mp->ma_values[ix] == NULL);
+    for (Py_ssize_t i = mp->ma_keys->dk_nentries - 1; i > ix; i--) {
+        if (mp->ma_values[i] != NULL) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 extern uint64_t _pydict_global_version;
 
 #define DICT_NEXT_VERSION() (++_pydict_global_version)
@@ -17,6 +17,13 @@ PyAPI_FUNC(void) _Py_dg_freedtoa(char *s);
 PyAPI_FUNC(double) _Py_dg_stdnan(int sign);
 PyAPI_FUNC(double) _Py_dg_infinity(int sign);
 
+/* Python/ryu.c: the digits _Py_dg_dtoa(d, 0, ...) returns for a finite d,
+   written to a buffer of _Py_RYU_DIGITS_SIZE chars without allocating. */
+
+#define _Py_RYU_DIGITS_SIZE 18
+
+extern int _Py_ryu_shortest(double d, char *digits, int *decpt, int *sign);
+
 #ifdef __cplusplus
 }
 #endif
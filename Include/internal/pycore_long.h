@@ -36,6 +36,12 @@ static inline PyObject* _PyLong_GetOne(void)
 
 PyObject *_PyLong_Add(PyLongObject *left, PyLongObject *right);
 
+/* Multiply with a given algorithm, for tests and benchmarks: 0 for the
+   school algorithm, 1 for Karatsuba, 2 for Toom-3 and 3 for the
+   number-theoretic transform. */
+PyAPI_FUNC(PyObject *) _PyLong_MulWithAlgorithm(PyObject *a, PyObject *b,
+                                                int algorithm);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,50 @@
+/* SIMD support.
+
+   SSE2 is part of the x86-64 baseline, so code guarded by _Py_HAVE_SSE2 can
+   use it without runtime CPU detection.  Every such code path must have a
+   portable fallback.
+*/
+
+#ifndef Py_INTERNAL_SIMD_H
+#define Py_INTERNAL_SIMD_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) \
+      || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define _Py_HAVE_SSE2 1
+#endif
+
+#ifdef _Py_HAVE_SSE2
+/* Return 0xFF in the bytes of v that are in [lo, hi], 0 elsewhere.  SSE2
+   only has signed byte comparisons, so shift the range to start at -128. */
+static inline __m128i
+_Py_in_range_epi8(__m128i v, unsigned char lo, unsigned char hi)
+{
+    __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8((char)lo));
+    return _mm_cmplt_epi8(_mm_xor_si128(offset, _mm_set1_epi8((char)0x80)),
+                          _mm_set1_epi8((char)((hi - lo + 1) ^ 0x80)));
+}
+#endif
+
+/* Later extensions need a runtime check.  With GCC and clang, a function
+   marked with _Py_TARGET("sse4.2") may use SSE4.2 intrinsics; call it only
+   if _Py_CPU_SUPPORTS("sse4.2") is true. */
+#if defined(_Py_HAVE_SSE2) && defined(__GNUC__) \
+      && (defined(__x86_64__) || defined(__i386__))
+#  include <immintrin.h>
+#  define _Py_HAVE_X86_TARGET 1
+#  define _Py_TARGET(features) __attribute__((target(features)))
+#  define _Py_CPU_SUPPORTS(feature) __builtin_cpu_supports(feature)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_SIMD_H */
@@ -13,6 +13,10 @@ PyAPI_FUNC(PyObject*) _Py_strhex_bytes(const char* argbuf, const Py_ssize_t argl
 /* These variants include support for a separator between every N bytes: */
 PyAPI_FUNC(PyObject*) _Py_strhex_with_sep(const char* argbuf, const Py_ssize_t arglen, const PyObject* sep, const int bytes_per_group);
 PyAPI_FUNC(PyObject*) _Py_strhex_bytes_with_sep(const char* argbuf, const Py_ssize_t arglen, const PyObject* sep, const int bytes_per_group);
+/* Decodes leading pairs of hex digits of argbuf into retbuf, stopping at the
+   first pair that isn't two hex digits.  Returns the number of hex digits
+   consumed. */
+PyAPI_FUNC(Py_ssize_t) _Py_strunhex(const char* argbuf, const Py_ssize_t arglen, char* retbuf);
 #endif /* !Py_LIMITED_API */
 
 #ifdef __cplusplus
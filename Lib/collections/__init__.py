@@ -1174,6 +1174,20 @@ def fromkeys(cls, iterable, value=None):
             d[key] = value
         return d
 
+    @classmethod
+    def from_pairs(cls, keys, values):
+        d = cls()
+        for key, value in zip(keys, values, strict=True):
+            d[key] = value
+        return d
+
+    @classmethod
+    def with_capacity(cls, n):
+        d = cls()
+        if not d.data:
+            d.data = d.data.with_capacity(n)
+        return d
+
 
 ################################################################################
 ### UserList
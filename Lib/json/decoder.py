@@ -131,6 +131,7 @@ def py_scanstring(s, end, strict=True,
 
 WHITESPACE = re.compile(r'[ \t\n\r]*', FLAGS)
 WHITESPACE_STR = ' \t\n\r'
+WHITESPACE_UTF8 = re.compile(rb'[ \t\n\r]*', FLAGS)
 
 
 def JSONObject(s_and_end, strict, scan_once, object_hook, object_pairs_hook,
@@ -283,7 +284,7 @@ class JSONDecoder(object):
 
     def __init__(self, *, object_hook=None, parse_float=None,
             parse_int=None, parse_constant=None, strict=True,
-            object_pairs_hook=None):
+            object_pairs_hook=None, cache_keys=False):
         """``object_hook``, if specified, will be called with the result
         of every JSON object decoded and its return value will be used in
         place of the given ``dict``.  This can be used to provide custom
@@ -315,6 +316,11 @@ def __init__(self, *, object_hook=None, parse_float=None,
         characters will be allowed inside strings.  Control characters in
         this context are those with character codes in the 0-31 range,
         including ``'\\t'`` (tab), ``'\\n'``, ``'\\r'`` and ``'\\0'``.
+
+        If ``cache_keys`` is true, the strings of recently seen object keys
+        are kept from one call of ``decode()`` to the next and reused for
+        equal keys, which speeds up decoding many documents with the same
+        keys.
         """
         self.object_hook = object_hook
         self.parse_float = parse_float or float
@@ -322,6 +328,7 @@ def __init__(self, *, object_hook=None, parse_float=None,
         self.parse_constant = parse_constant or _CONSTANTS.__getitem__
         self.strict = strict
         self.object_pairs_hook = object_pairs_hook
+        self.cache_keys = cache_keys
         self.parse_object = JSONObject
         self.parse_array = JSONArray
         self.parse_string = scanstring
@@ -354,3 +361,33 @@ def raw_decode(self, s, idx=0):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+    def _decode_utf8(self, b, _w=WHITESPACE_UTF8.match):
+        """Return the Python representation of ``b`` (a UTF-8 encoded
+        JSON document) without decoding it to ``str`` first.
+
+        Return ``NotImplemented`` if ``b`` must be decoded and passed to
+        ``decode()``, either because the document is not valid or because
+        this decoder does not use the C scanner.  Since ``b`` may then be
+        parsed twice, hooks and parse functions other than the defaults
+        also send ``b`` to ``decode()``, so that they are called only once.
+        """
+        if (type(self).decode is not JSONDecoder.decode or
+                type(self).raw_decode is not JSONDecoder.raw_decode or
+                scanner.c_make_scanner is None or
+                type(self.scan_once) is not scanner.c_make_scanner):
+            return NotImplemented
+        scan = self.scan_once
+        if (scan.object_hook is not None or
+                scan.object_pairs_hook is not None or
+                scan.parse_float is not float or
+                scan.parse_int is not int or
+                scan.parse_constant != _CONSTANTS.__getitem__):
+            return NotImplemented
+        res = self.scan_once(b, _w(b, 0).end())
+        if res is None:
+            return NotImplemented
+        obj, end = res
+        if _w(b, end).end() != len(b):
+            return NotImplemented
+        return obj
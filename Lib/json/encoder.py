@@ -201,7 +201,7 @@ def encode(self, o):
             chunks = list(chunks)
         return ''.join(chunks)
 
-    def iterencode(self, o, _one_shot=False):
+    def iterencode(self, o, _one_shot=False, _write=None):
         """Encode the given object and yield each string
         representation as available.
 
@@ -211,6 +211,8 @@ def iterencode(self, o, _one_shot=False):
                 mysocket.write(chunk)
 
         """
+        # If _write is given, the C encoder may pass the output to it in
+        # large chunks itself and return an empty iterable.
         if self.check_circular:
             markers = {}
         else:
@@ -243,12 +245,15 @@ def floatstr(o, allow_nan=self.allow_nan,
             return text
 
 
-        if (_one_shot and c_make_encoder is not None
+        if ((_one_shot or _write is not None) and c_make_encoder is not None
                 and self.indent is None):
             _iterencode = c_make_encoder(
                 markers, self.default, _encoder, self.indent,
                 self.key_separator, self.item_separator, self.sort_keys,
                 self.skipkeys, self.allow_nan)
+            if _write is not None:
+                _iterencode(o, 0, _write)
+                return ()
         else:
             _iterencode = _make_iterencode(
                 markers, self.default, _encoder, self.indent, floatstr,
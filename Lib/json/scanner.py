@@ -8,6 +8,9 @@
 
 __all__ = ['make_scanner']
 
+# Number of object keys kept between documents with cache_keys
+_KEY_CACHE_SIZE = 256
+
 NUMBER_RE = re.compile(
     r'(-?(?:0|[1-9]\d*))(\.\d+)?([eE][-+]?\d+)?',
     (re.VERBOSE | re.MULTILINE | re.DOTALL))
@@ -24,6 +27,7 @@ def py_make_scanner(context):
     object_hook = context.object_hook
     object_pairs_hook = context.object_pairs_hook
     memo = context.memo
+    cache_keys = getattr(context, 'cache_keys', False)
 
     def _scan_once(string, idx):
         try:
@@ -66,7 +70,8 @@ def scan_once(string, idx):
         try:
             return _scan_once(string, idx)
         finally:
-            memo.clear()
+            if not cache_keys or len(memo) > _KEY_CACHE_SIZE:
+                memo.clear()
 
     return scan_once
 
@@ -407,7 +407,7 @@ def decode_long(data):
 class _Pickler:
 
     def __init__(self, file, protocol=None, *, fix_imports=True,
-                 buffer_callback=None):
+                 buffer_callback=None, memoize_atomic=True):
         """This takes a binary file for writing a pickle data stream.
 
         The optional *protocol* argument tells the pickler to use the
@@ -440,6 +440,11 @@ def __init__(self, file, protocol=None, *, fix_imports=True,
 
         It is an error if *buffer_callback* is not None and *protocol*
         is None or smaller than 5.
+
+        If *memoize_atomic* is false, str and bytes objects are not
+        memoized: every occurrence is pickled in full and unpickled as a
+        distinct object.  This makes pickling faster when such objects
+        are rarely repeated.
         """
         if protocol is None:
             protocol = DEFAULT_PROTOCOL
@@ -462,6 +467,7 @@ def __init__(self, file, protocol=None, *, fix_imports=True,
         self.bin = protocol >= 1
         self.fast = 0
         self.fix_imports = fix_imports and protocol < 3
+        self.memoize_atomic = memoize_atomic
 
     def clear_memo(self):
         """Clears the pickler's "memo".
@@ -803,7 +809,8 @@ def save_bytes(self, obj):
             self._write_large_bytes(BINBYTES + pack("<I", n), obj)
         else:
             self.write(BINBYTES + pack("<I", n) + obj)
-        self.memoize(obj)
+        if self.memoize_atomic:
+            self.memoize(obj)
     dispatch[bytes] = save_bytes
 
     def save_bytearray(self, obj):
@@ -868,7 +875,8 @@ def save_str(self, obj):
             obj = obj.replace("\x1a", "\\u001a")  # EOF on DOS
             self.write(UNICODE + obj.encode('raw-unicode-escape') +
                        b'\n')
-        self.memoize(obj)
+        if self.memoize_atomic:
+            self.memoize(obj)
     dispatch[str] = save_str
 
     def save_tuple(self, obj):
@@ -1747,14 +1755,18 @@ def load_stop(self):
 
 # Shorthands
 
-def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None,
+          memoize_atomic=True):
     _Pickler(file, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback,
+             memoize_atomic=memoize_atomic).dump(obj)
 
-def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None,
+           memoize_atomic=True):
     f = io.BytesIO()
     _Pickler(f, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback,
+             memoize_atomic=memoize_atomic).dump(obj)
     res = f.getvalue()
     assert isinstance(res, bytes_types)
     return res
@@ -2421,6 +2421,54 @@ def test_many_puts_and_gets(self):
                 loaded = self.loads(dumped)
                 self.assert_is_copy(obj, loaded)
 
+    def test_many_shared_objects(self):
+        # Enough objects to grow the memo table many times, shared between
+        # containers and saved again after the table has grown.
+        items = [('t%d' % i, b'b%d' % i, [i]) for i in range(20000)]
+        big = [bytes(1000) for i in range(100)]
+        obj = [items, {'k%d' % i: item for i, item in enumerate(items)},
+               big, big[::-1], items[::-3]]
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                loaded = self.loads(self.dumps(obj, proto))
+                self.assert_is_copy(obj, loaded)
+                self.assertIs(loaded[1]['k5'], loaded[0][5])
+                self.assertIs(loaded[3][0], loaded[2][-1])
+                self.assertIs(loaded[4][1], loaded[0][-4])
+
+    def test_containers_of_numbers(self):
+        # Long runs of numbers, None and bools, interrupted by other objects,
+        # in lists, tuples and dicts.
+        atoms = [0, 1, -1, 255, 256, 65535, 65536, 2**31 - 1, -2**31,
+                 2**31, -2**31 - 1, 2**63, 0.0, -0.0, 1.5, float('inf'),
+                 None, True, False]
+        items = atoms * 200 + ['x', atoms, (1, 2.5)] + atoms * 3
+        obj = [items, tuple(items), dict(zip(range(len(items)), items)),
+               {x: 1.5 for x in atoms if not isinstance(x, bool)}]
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                loaded = self.loads(self.dumps(obj, proto))
+                self.assert_is_copy(obj, loaded)
+                self.assertEqual([type(x) for x in loaded[0]],
+                                 [type(x) for x in items])
+
+    def test_memoize_atomic(self):
+        s = 'abc' * 10
+        b = b'xyz' * 10
+        t = (s, b)
+        obj = [s, b, t, t, [s, b]]
+        for proto in protocols:
+            with self.subTest(proto=proto):
+                pickled = self.dumps(obj, proto, memoize_atomic=False)
+                loaded = self.loads(pickled)
+                self.assertEqual(loaded, obj)
+                self.assertIs(loaded[2], loaded[3])
+                self.assertIsNot(loaded[2][0], loaded[0])
+                self.assertIsNot(loaded[4][0], loaded[0])
+                self.assertGreater(len(pickled), len(self.dumps(obj, proto)))
+                if proto >= 3:
+                    self.assertIsNot(loaded[4][1], loaded[1])
+
     def test_attribute_name_interning(self):
         # Test that attribute names of pickled objects are interned when
         # unpickling.
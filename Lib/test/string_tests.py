@@ -1020,6 +1020,41 @@ def test_title(self):
         self.checkequal('Getint', "getInt", 'title')
         self.checkraises(TypeError, 'hello', 'title', 42)
 
+    def test_split_long(self):
+        # Long inputs are scanned in blocks; put separators, whitespace
+        # and line breaks at every offset around the block boundaries.
+        def split_whitespace(text, maxsplit):
+            words = text.split()
+            if 0 <= maxsplit < len(words):
+                rest = text
+                for word in words[:maxsplit]:
+                    rest = rest.lstrip()[len(word):]
+                words = words[:maxsplit] + [rest.lstrip()]
+            return words
+
+        fields = ['a', '', 'bb', 'ccccccccccccccccccc', 'd' * 33]
+        for n in range(1, 45):
+            parts = [fields[i * 7 % len(fields)] + 'x' * (i % 3)
+                     for i in range(n)]
+            text = '|'.join(parts)
+            self.checkequal(parts, text, 'split', '|')
+            self.checkequal(n - 1, text, 'count', '|')
+            for maxsplit in 0, 1, n // 2:
+                k = min(maxsplit, n - 1)
+                self.checkequal(parts[:k] + ['|'.join(parts[k:])],
+                                text, 'split', '|', maxsplit)
+            for sep in ' ', '\t\n ', '\r\x0b\x0c':
+                text = sep.join(parts)
+                for maxsplit in -1, 0, 1, n // 2:
+                    self.checkequal(split_whitespace(text, maxsplit),
+                                    text, 'split', None, maxsplit)
+            lines = parts + ['end']
+            for eol in '\n', '\r', '\r\n':
+                text = eol.join(lines)
+                self.checkequal(lines, text, 'splitlines')
+                self.checkequal([line + eol for line in lines[:-1]] + ['end'],
+                                text, 'splitlines', True)
+
     def test_splitlines(self):
         self.checkequal(['abc', 'def', '', 'ghi'], "abc\ndef\n\rghi", 'splitlines')
         self.checkequal(['abc', 'def', '', 'ghi'], "abc\ndef\n\r\nghi", 'splitlines')
@@ -12,7 +12,7 @@
                  'hexlify']
 a2b_functions = ['a2b_base64', 'a2b_hex', 'a2b_qp', 'a2b_uu',
                  'unhexlify']
-all_functions = a2b_functions + b2a_functions + ['crc32', 'crc_hqx']
+all_functions = a2b_functions + b2a_functions + ['crc32', 'crc32c', 'crc_hqx']
 
 
 class BinASCIITest(unittest.TestCase):
@@ -57,6 +57,7 @@ def test_returned_value(self):
             self.assertLess(max(a), 128)
         self.assertIsInstance(binascii.crc_hqx(raw, 0), int)
         self.assertIsInstance(binascii.crc32(raw), int)
+        self.assertIsInstance(binascii.crc32c(raw), int)
 
     def test_base64valid(self):
         # Test base64 with valid data
@@ -154,6 +155,34 @@ def assertDiscontinuousPadding(data, non_strict_mode_expected_result: bytes):
         assertDiscontinuousPadding(b'ab=ab==', b'i\xb6\x9b')
 
 
+    def test_base64_long(self):
+        # Long base64 data is converted in blocks; check every alignment of
+        # the data and of a stray character against a per-byte reference.
+        table = (b'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz'
+                 b'0123456789+/')
+        def reference(data):
+            bits = ''.join('{:08b}'.format(c) for c in data)
+            bits += '0' * (-len(bits) % 6)
+            chars = bytes(table[int(bits[i:i+6], 2)]
+                          for i in range(0, len(bits), 6))
+            return chars + b'=' * (-len(chars) % 4)
+        data = bytes(range(256)) * 2
+        for n in range(0, 100):
+            encoded = reference(data[:n])
+            self.assertEqual(binascii.b2a_base64(self.type2test(data[:n]),
+                                                 newline=False), encoded)
+            self.assertEqual(binascii.a2b_base64(self.type2test(encoded),
+                                                 strict_mode=True), data[:n])
+        encoded = reference(data)
+        for pos in range(0, 80):
+            for c in b'\n', b'=', b'-', b'\xff':
+                noisy = encoded[:pos] + c + encoded[pos:]
+                self.assertEqual(binascii.a2b_base64(self.type2test(noisy)),
+                                 data if c != b'=' or pos % 4 != 3 else
+                                 data[:pos * 3 // 4])
+                self.assertRaises(binascii.Error, binascii.a2b_base64,
+                                  self.type2test(noisy), strict_mode=True)
+
     def test_base64errors(self):
         # Test base64 with invalid padding
         def assertIncorrectPadding(data):
@@ -241,6 +270,54 @@ def test_crc32(self):
 
         self.assertRaises(TypeError, binascii.crc32)
 
+    def test_crc32_long(self):
+        # Long inputs take a different code path than short chunks.
+        data = bytes(range(256)) * 60 + b'abc'
+        for crc32 in binascii.crc32, binascii.crc32c:
+            with self.subTest(crc32.__name__):
+                for start in range(17):
+                    crc = 0x12345678
+                    for i in range(start, len(data), 7):
+                        crc = crc32(self.type2test(data[i:i+7]), crc)
+                    self.assertEqual(
+                        crc32(self.type2test(data[start:]), 0x12345678), crc)
+
+    def test_crc32c(self):
+        self.assertEqual(binascii.crc32c(self.type2test(b'')), 0)
+        self.assertEqual(binascii.crc32c(self.type2test(b'123456789')),
+                         0xe3069283)
+        # Test vectors from RFC 3720, appendix B.4.
+        self.assertEqual(binascii.crc32c(self.type2test(bytes(32))),
+                         0x8a9136aa)
+        self.assertEqual(binascii.crc32c(self.type2test(b'\xff' * 32)),
+                         0x62a8ab43)
+        self.assertEqual(binascii.crc32c(self.type2test(bytes(range(32)))),
+                         0x46dd794e)
+        crc = binascii.crc32c(self.type2test(b"Test the CRC-32C of"))
+        crc = binascii.crc32c(self.type2test(b" this string."), crc)
+        self.assertEqual(crc,
+                         binascii.crc32c(b"Test the CRC-32C of this string."))
+        self.assertEqual(binascii.crc32c(self.type2test(b'a'), -1),
+                         binascii.crc32c(b'a', 0xffffffff))
+
+        self.assertRaises(TypeError, binascii.crc32c)
+        self.assertRaises(TypeError, binascii.crc32c, 'abc')
+
+    def test_crc32_combine(self):
+        data = bytes(range(256)) * 5
+        for crc32, combine in ((binascii.crc32, binascii.crc32_combine),
+                               (binascii.crc32c, binascii.crc32c_combine)):
+            with self.subTest(crc32.__name__):
+                for i in 0, 1, 3, 100, 640, 1279, 1280:
+                    a, b = data[:i], data[i:]
+                    self.assertEqual(
+                        combine(crc32(self.type2test(a)),
+                                crc32(self.type2test(b)), len(b)),
+                        crc32(self.type2test(data)))
+                self.assertEqual(combine(0x12345678, 0, 0), 0x12345678)
+                self.assertRaises(ValueError, combine, 0, 0, -1)
+                self.assertRaises(TypeError, combine, 0, 0)
+
     def test_hex(self):
         # test hexlification
         s = b'{s\005\000\000\000worldi\002\000\000\000s\005\000\000\000helloi\001\000\000\0000'
@@ -259,6 +336,20 @@ def test_hex(self):
         self.assertEqual(binascii.hexlify(self.type2test(s)), t)
         self.assertEqual(binascii.unhexlify(self.type2test(t)), u)
 
+    def test_hex_long(self):
+        data = bytes(range(256)) * 2
+        for n in 0, 15, 16, 17, 31, 32, 33, 512:
+            t = binascii.hexlify(self.type2test(data[:n]))
+            self.assertEqual(t, data[:n].hex().encode('ascii'))
+            self.assertEqual(binascii.unhexlify(self.type2test(t)), data[:n])
+            self.assertEqual(binascii.unhexlify(self.type2test(t.upper())),
+                             data[:n])
+        t = binascii.hexlify(data)
+        for pos in 0, 31, 32, 33, 1000:
+            for c in b'g', b' ', b'\xff':
+                self.assertRaises(binascii.Error, binascii.a2b_hex,
+                                  self.type2test(t[:pos] + c + t[pos + 1:]))
+
     def test_hex_separator(self):
         """Test that hexlify and b2a_hex are binary versions of bytes.hex."""
         # Logic of separators is tested in test_bytes.py.  This checks that
@@ -469,6 +469,24 @@ def test_fromhex(self):
                 self.type2test.fromhex(data)
             self.assertIn('at position %s' % pos, str(cm.exception))
 
+    def test_fromhex_long(self):
+        # long runs of hex digits are decoded 16 bytes at a time
+        data = bytes(range(256)) * 2
+        for n in 0, 15, 16, 17, 31, 32, 33, 100, 512:
+            for s in data[:n].hex(), data[:n].hex().upper():
+                self.assertEqual(self.type2test.fromhex(s), data[:n])
+                self.assertEqual(self.type2test.fromhex(s[:30] + ' ' + s[30:]),
+                                 data[:n])
+        s = data.hex()
+        for pos in 0, 1, 30, 31, 32, 33, 63, 64, 500, len(s) - 1:
+            for c in 'g', 'G', '/', ':', '@', '`', '\x00', '\x7f':
+                with self.assertRaises(ValueError) as cm:
+                    self.type2test.fromhex(s[:pos] + c + s[pos + 1:])
+                self.assertIn('at position %s' % pos, str(cm.exception))
+        with self.assertRaises(ValueError) as cm:
+            self.type2test.fromhex(s + '1')
+        self.assertIn('at position %s' % (len(s) + 1), str(cm.exception))
+
     def test_hex(self):
         self.assertRaises(TypeError, self.type2test.hex)
         self.assertRaises(TypeError, self.type2test.hex, 1)
@@ -534,6 +552,23 @@ def test_hex_separator_six_bytes(self):
         self.assertEqual(six_bytes.hex(':', -6), '0306090c0f12')
         self.assertEqual(six_bytes.hex(' ', -95), '0306090c0f12')
 
+    def test_hex_long(self):
+        data = self.type2test(bytes(range(256)) * 2)
+        digits = ['%02x' % c for c in data]
+        self.assertEqual(data.hex(), ''.join(digits))
+        for n in 15, 16, 17, 33, 100:
+            b = data[:n]
+            for group in 1, 2, 7, 16, 17, 32, 40:
+                # groups count from the right for positive bytes_per_sep
+                first = n % group or group
+                chunks = [''.join(digits[:first])]
+                chunks += [''.join(digits[i:min(i + group, n)])
+                           for i in range(first, n, group)]
+                self.assertEqual(b.hex(':', group), ':'.join(chunks))
+                chunks = [''.join(digits[i:min(i + group, n)])
+                          for i in range(0, n, group)]
+                self.assertEqual(b.hex(':', -group), ':'.join(chunks))
+
     def test_join(self):
         self.assertEqual(self.type2test(b"").join([]), b"")
         self.assertEqual(self.type2test(b"").join([b""]), b"")
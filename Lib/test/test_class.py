@@ -666,5 +666,96 @@ def __init__(self, *args, **kwargs):
         with self.assertRaisesRegex(TypeError, error_msg):
             object.__init__(E(), 42)
 
+    def testInstanceAttributeOrder(self):
+        # Attributes set directly on an instance must behave the same whether
+        # or not the instance has a __dict__ object yet.
+        class C:
+            def __init__(self, a):
+                self.a = a
+                self.b = a + 1
+
+        c = C(1)
+        c.c = 3
+        del c.c
+        self.assertFalse(hasattr(c, 'c'))
+        c.c = 4
+        self.assertEqual(list(c.__dict__.items()), [('a', 1), ('b', 2), ('c', 4)])
+
+        d = C(5)
+        del d.a
+        self.assertRaises(AttributeError, getattr, d, 'a')
+        with self.assertRaises(AttributeError):
+            del d.a
+        d.a = 7
+        self.assertEqual(list(vars(d).items()), [('b', 6), ('a', 7)])
+
+        e = C(1)
+        e.__dict__ = {'x': 1}
+        self.assertEqual(e.x, 1)
+        self.assertFalse(hasattr(e, 'a'))
+
+        class D(C):
+            pass
+        f = D(2)
+        f.z = 1
+        f.__class__ = C
+        self.assertEqual(vars(f), {'a': 2, 'b': 3, 'z': 1})
+
+        class S(str):
+            pass
+        g = C(1)
+        setattr(g, S('a'), 10)
+        self.assertEqual(g.a, 10)
+        self.assertEqual(getattr(g, S('b')), 2)
+
+    def testManyInstanceAttributes(self):
+        class C:
+            pass
+        names = ['x%d' % i for i in range(40)]
+        a = C()
+        for i, name in enumerate(names):
+            setattr(a, name, i)
+        b = C()
+        for i, name in reversed(list(enumerate(names))):
+            setattr(b, name, i)
+        self.assertEqual([getattr(a, name) for name in names], list(range(40)))
+        self.assertEqual([getattr(b, name) for name in names], list(range(40)))
+        self.assertEqual(list(vars(a)), names)
+        self.assertEqual(list(vars(b)), names[::-1])
+
+    def testInstanceAttributeOrderVaries(self):
+        class C:
+            def __init__(self, flag):
+                if flag:
+                    self.a = 1
+                    self.b = 2
+                else:
+                    self.b = 2
+                    self.a = 1
+
+        def churn(obj):
+            # Loop enough for the attribute accesses to be specialized
+            for i in range(50):
+                del obj.a
+                obj.a = i
+                obj.c = i
+                del obj.b
+                obj.b = i
+                del obj.c
+            return obj
+
+        objs = [C(i % 2) for i in range(20)]
+        self.assertEqual(list(vars(objs[0])), ['b', 'a'])
+        self.assertEqual(list(vars(objs[1])), ['a', 'b'])
+        self.assertEqual(list(vars(churn(C(1))).items()), [('a', 49), ('b', 49)])
+        self.assertEqual(list(vars(churn(C(0))).items()), [('a', 49), ('b', 49)])
+        c = C(0)
+        c.z = 3
+        del c.b
+        self.assertEqual(list(vars(c).items()), [('a', 1), ('z', 3)])
+        del c.a, c.z
+        self.assertEqual(vars(c), {})
+
+
 if __name__ == '__main__':
     unittest.main()
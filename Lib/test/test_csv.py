@@ -335,6 +335,27 @@ def test_read_quoting(self):
                           ['abc,3'], [[]],
                           quoting=csv.QUOTE_NONNUMERIC)
 
+    def test_read_long_fields(self):
+        # Fields longer than the 16-character blocks searched at once for
+        # delimiters, quotes and line ends.
+        for n in 15, 16, 17, 40:
+            with self.subTest(n=n):
+                a, b = 'a' * n, 'b\xe9' * n
+                self._read_test(['%s,%s\r\n' % (a, b)], [[a, b]])
+                self._read_test(['%s;%s' % (a, b)], [[a, b]], delimiter=';')
+                self._read_test(['%s,"%s""%s"' % (a, a, b)],
+                                [[a, a + '"' + b]])
+                self._read_test(['"%s\n' % a, '%s",%s' % (b, a)],
+                                [[a + '\n' + b, a]])
+                self._read_test(['%s\\,%s,%s' % (a, b, a)],
+                                [[a + ',' + b, a]], escapechar='\\')
+                self._read_test(['%s, %s' % (a, b)], [[a, b]],
+                                skipinitialspace=True)
+                self.assertRaises(csv.Error, self._read_test,
+                                  ['%s\0%s' % (a, b)], [])
+                self.assertRaises(csv.Error, self._read_test,
+                                  ['%s\n%s' % (a, b)], [])
+
     def test_read_bigfield(self):
         # This exercises the buffer realloc functionality and field size
         # limits.
@@ -366,6 +387,79 @@ def test_read_linenum(self):
         self.assertRaises(StopIteration, next, r)
         self.assertEqual(r.line_num, 3)
 
+    def test_read_columns(self):
+        lines = ['x,y,z', '1,2.5,"a,b"', '', '3,-4e3,c', '5,6,d']
+        r = csv.reader(lines)
+        self.assertEqual(r.read_columns(2),
+                         [['x', '1'], ['y', '2.5'], ['z', 'a,b']])
+        self.assertEqual(r.line_num, 2)
+        self.assertEqual(r.read_columns(types=[int, float, None]),
+                         [[3, 5], [-4000.0, 6.0], ['c', 'd']])
+        self.assertEqual(r.read_columns(), [])
+        self.assertEqual(csv.reader([]).read_columns(), [])
+        self.assertEqual(csv.reader(lines).read_columns(0), [])
+        # Rows are mixed with read_columns() freely.
+        r = csv.reader(lines)
+        self.assertEqual(next(r), ['x', 'y', 'z'])
+        self.assertEqual(r.read_columns(1, types=[str, str.upper, len]),
+                         [['1'], ['2.5'], [3]])
+        self.assertEqual(next(r), [])
+        self.assertEqual(list(r), [['3', '-4e3', 'c'], ['5', '6', 'd']])
+        # Other converters, and int and float given non-strings.
+        r = csv.reader(['1,2', '3,4'], quoting=csv.QUOTE_NONNUMERIC)
+        self.assertEqual(r.read_columns(types=[int, float]),
+                         [[1, 3], [2.0, 4.0]])
+        r = csv.reader(['1,2', '3,4'])
+        self.assertEqual(r.read_columns(types=(None, lambda s: s * 2)),
+                         [['1', '3'], ['22', '44']])
+
+    def test_read_columns_errors(self):
+        # The records before a malformed one are returned, and the next
+        # call raises for it.
+        r = csv.reader(['a,b', 'c', 'd,e'])
+        self.assertEqual(r.read_columns(), [['a'], ['b']])
+        with self.assertRaisesRegex(csv.Error, r'expected 2 fields, saw 1 '
+                                               r'\(line 2\)'):
+            r.read_columns()
+        self.assertEqual(next(r), ['d', 'e'])
+        r = csv.reader(['a,b', '1,2', '', '3,4', '5'])
+        self.assertEqual(r.read_columns(), [['a', '1', '3'], ['b', '2', '4']])
+        self.assertRaises(csv.Error, list, r)
+        self.assertEqual(list(r), [])
+        r = csv.reader(['a,b', 'c,d,e', 'f,g'])
+        self.assertEqual(r.read_columns(types=[str.upper, None]),
+                         [['A'], ['b']])
+        self.assertRaises(csv.Error, r.read_columns)
+        self.assertEqual(r.read_columns(), [['f'], ['g']])
+        r = csv.reader(['a,b', '"c"d,e', 'f,g'], strict=True)
+        self.assertEqual(r.read_columns(), [['a'], ['b']])
+        self.assertRaises(csv.Error, next, r)
+        self.assertEqual(r.read_columns(), [['f'], ['g']])
+        self.assertRaises(ValueError,
+                          csv.reader(['a,b']).read_columns, types=[int])
+        self.assertRaises(ValueError,
+                          csv.reader(['a,b']).read_columns, types=[int, None])
+        self.assertRaises(TypeError,
+                          csv.reader(['a,b']).read_columns, types=1)
+        self.assertRaises(csv.Error, csv.reader([1]).read_columns)
+        self.assertRaises(csv.Error, csv.reader(['"a'], strict=True)
+                          .read_columns)
+
+        class Lines:
+            def __init__(self, lines):
+                self.lines = iter(lines)
+            def __iter__(self):
+                return self
+            def __next__(self):
+                line = next(self.lines)
+                if line == 'next':
+                    next(r)
+                return line
+        r = csv.reader(Lines(['a,b', 'c,d', 'next', 'e,f']))
+        with self.assertRaisesRegex(RuntimeError, 'read_columns'):
+            r.read_columns()
+        self.assertEqual(next(r), ['e', 'f'])
+
     def test_roundtrip_quoteed_newlines(self):
         with TemporaryFile("w+", encoding="utf-8", newline='') as fileobj:
             writer = csv.writer(fileobj)
@@ -322,6 +322,75 @@ def __new__(cls):
         res.update(a=None, b=None, c=None)
         self.assertEqual(baddict3.fromkeys({"a", "b", "c"}), res)
 
+    def test_from_pairs(self):
+        self.assertEqual(dict.from_pairs('abc', range(3)), {'a':0, 'b':1, 'c':2})
+        self.assertEqual(dict.from_pairs([], ()), {})
+        self.assertEqual(dict.from_pairs('aba', range(3)), {'a':2, 'b':1})
+        self.assertEqual(list(dict.from_pairs('cba', 'xyz').items()),
+                         [('c', 'x'), ('b', 'y'), ('a', 'z')])
+        def g(n):
+            yield from range(n)
+        self.assertEqual(dict.from_pairs(g(3), g(3)), {0:0, 1:1, 2:2})
+        self.assertRaises(TypeError, dict.from_pairs, 'abc')
+        self.assertRaises(TypeError, dict.from_pairs, 3, [])
+        self.assertRaises(TypeError, dict.from_pairs, [[]], [1])
+        with self.assertRaisesRegex(ValueError, 'shorter'):
+            dict.from_pairs('abc', range(2))
+        with self.assertRaisesRegex(ValueError, 'longer'):
+            dict.from_pairs('ab', g(3))
+
+        class dictlike(dict): pass
+        self.assertIsInstance(dictlike.from_pairs('a', 'b'), dictlike)
+        self.assertEqual(dictlike.from_pairs('a', 'b'), {'a':'b'})
+
+        class Exc(Exception): pass
+        class baddict(dict):
+            def __setitem__(self, key, value):
+                raise Exc()
+        self.assertRaises(Exc, baddict.from_pairs, [1], [2])
+
+        class BadLengthHint:
+            def __iter__(self):
+                return iter(())
+            def __length_hint__(self):
+                raise Exc()
+        self.assertRaises(Exc, dict.from_pairs, BadLengthHint(), [])
+
+    def test_with_capacity(self):
+        d = dict.with_capacity(1000)
+        self.assertEqual(d, {})
+        self.assertIs(type(d), dict)
+        self.assertEqual(dict.with_capacity(0), {})
+        self.assertRaises(ValueError, dict.with_capacity, -1)
+        self.assertRaises(TypeError, dict.with_capacity, 1.0)
+        self.assertRaises((MemoryError, OverflowError),
+                          dict.with_capacity, sys.maxsize)
+
+        class dictlike(dict): pass
+        self.assertIsInstance(dictlike.with_capacity(10), dictlike)
+
+    @support.cpython_only
+    def test_with_capacity_presizes(self):
+        n = 1000
+        d = dict.with_capacity(n)
+        size = sys.getsizeof(d)
+        for i in range(n):
+            d[i] = i
+        self.assertEqual(sys.getsizeof(d), size)
+        self.assertGreater(size, sys.getsizeof({}))
+
+    @support.cpython_only
+    def test_presize_duplicate_keys(self):
+        # The length hint counts items, not distinct keys: a dict built
+        # from many duplicates is not left with a huge table.
+        small = sys.getsizeof(dict([(0, 0)]))
+        self.assertEqual(sys.getsizeof(dict([(0, 0)] * 100000)), small)
+        self.assertEqual(sys.getsizeof(dict.from_pairs([0] * 100000,
+                                                       [0] * 100000)),
+                         small)
+        self.assertEqual(sys.getsizeof(dict(zip([0] * 100000, range(100000)))),
+                         small)
+
     def test_copy(self):
         d = {1: 1, 2: 2, 3: 3}
         self.assertIsNot(d.copy(), d)
@@ -1104,6 +1173,47 @@ class C:
         a.a = 3
         self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
 
+    @support.cpython_only
+    def test_splittable_delattr(self):
+        """Deleting or skipping attributes keeps the table split."""
+        import _testcapi
+
+        class C:
+            def __init__(self, flag):
+                self.a = 1
+                if flag:
+                    self.b = 2
+                self.c = 3
+
+        a = C(True)
+        b = C(False)
+        self.assertTrue(_testcapi.dict_hassplittable(b.__dict__))
+        self.assertEqual(list(b.__dict__), ['a', 'c'])
+
+        del a.b
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertEqual(list(a.__dict__.items()), [('a', 1), ('c', 3)])
+        self.assertEqual(len(a.__dict__), 2)
+        self.assertEqual(list(reversed(a.__dict__)), ['c', 'a'])
+
+        # Other instances still share the keys
+        c = C(True)
+        self.assertTrue(_testcapi.dict_hassplittable(c.__dict__))
+
+        # Deleting the last attribute allows to set it again in order
+        del a.c
+        a.c = 4
+        self.assertTrue(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertEqual(list(a.__dict__.items()), [('a', 1), ('c', 4)])
+
+        # Filling a hole out of order converts this instance only
+        a.b = 5
+        self.assertFalse(_testcapi.dict_hassplittable(a.__dict__))
+        self.assertEqual(list(a.__dict__.items()),
+                         [('a', 1), ('c', 4), ('b', 5)])
+        c = C(True)
+        self.assertTrue(_testcapi.dict_hassplittable(c.__dict__))
+
     def test_iterator_pickling(self):
         for proto in range(pickle.HIGHEST_PROTOCOL + 1):
             data = {1:"a", 2:"b", 3:"c"}
@@ -1,4 +1,6 @@
+import decimal
 import fractions
+import math
 import operator
 import os
 import random
@@ -875,6 +877,63 @@ def test_short_repr(self):
             self.assertEqual(repr(float(s)), str(float(s)))
             self.assertEqual(repr(float(negs)), str(float(negs)))
 
+    @staticmethod
+    def shortest_digits(x):
+        # Reference for the shortest repr of a positive finite float: the
+        # shortest digit string n * 10**e rounding back to x and, among
+        # those, the one closest to x, ties going to an even n.
+        f = fractions.Fraction(x)
+        down = fractions.Fraction(math.nextafter(x, 0.0))
+        up = math.nextafter(x, INF)
+        up = 2 * f - down if isinf(up) else fractions.Fraction(up)
+        lo, hi = (f + down) / 2, (f + up) / 2
+        inclusive = struct.unpack('<Q', struct.pack('<d', x))[0] % 2 == 0
+        def inside(v):
+            return lo <= v <= hi if inclusive else lo < v < hi
+        k = math.floor(math.log10(x))
+        while fractions.Fraction(10)**k > f:
+            k -= 1
+        while fractions.Fraction(10)**(k + 1) <= f:
+            k += 1
+        for ndigits in range(1, 18):
+            scale = fractions.Fraction(10)**(k - ndigits + 1)
+            q = f / scale
+            candidates = [n for n in (math.floor(q), math.ceil(q))
+                          if inside(n * scale)]
+            if candidates:
+                n = min(candidates, key=lambda n: (abs(n - q), n % 2))
+                e = k - ndigits + 1
+                while n % 10 == 0:
+                    n //= 10
+                    e += 1
+                return n, e
+        raise AssertionError("no shortest repr for %r" % x)
+
+    @unittest.skipUnless(getattr(sys, 'float_repr_style', '') == 'short',
+                         "applies only when using short float repr style")
+    def test_shortest_repr(self):
+        # repr() gives the shortest string that round-trips, picking the
+        # closest one if there are several.
+        rng = random.Random(38)
+        values = [5e-324, 2.2250738585072014e-308, 2.225073858507201e-308,
+                  1.7976931348623157e+308, 1e23, 9007199254740993.0,
+                  2.0**63, 0.1, 1/3, 2/3]
+        values += [2.0**e for e in range(-1074, 1024, 7)]
+        values += [math.nextafter(2.0**e, INF) for e in range(-1000, 1024, 37)]
+        values += [math.nextafter(2.0**e, 0.0) for e in range(-1000, 1024, 37)]
+        values += [float(rng.getrandbits(rng.randrange(1, 90)) or 1)
+                   for _ in range(200)]
+        for _ in range(500):
+            bits = rng.getrandbits(63)
+            if bits >> 52 != 0x7ff and bits:
+                values.append(struct.unpack('<d', struct.pack('<Q', bits))[0])
+        for x in values:
+            with self.subTest(x=x.hex()):
+                d = decimal.Decimal(repr(x)).normalize().as_tuple()
+                self.assertEqual((int(''.join(map(str, d.digits))), d.exponent),
+                                 self.shortest_digits(x))
+                self.assertEqual(repr(-x), '-' + repr(x))
+
 @support.requires_IEEE_754
 class RoundTestCase(unittest.TestCase):
 
@@ -96,6 +96,17 @@ class TestTuple(TestInvariantWithoutMutations, unittest.TestCase):
     def setUp(self):
         self.it = iter(tuple(range(n)))
 
+class TestZip(TestInvariantWithoutMutations, unittest.TestCase):
+
+    def setUp(self):
+        self.it = zip(range(n), range(n, 3*n), 'x'*(n+1))
+
+    def test_unsized_argument(self):
+        # The length is only known if it is known for every argument
+        it = zip(range(n), iter(int, 1))
+        self.assertEqual(length_hint(it, -1), -1)
+        self.assertEqual(length_hint(zip(), -1), 0)
+
 ## ------- Types that should not be mutated during iteration -------
 
 class TestDeque(TestTemporarilyImmutable, unittest.TestCase):
@@ -62,6 +62,28 @@ def test_keys_reuse(self):
         self.check_keys_reuse(s, decoder.decode)
         self.assertFalse(decoder.memo)
 
+    def test_cache_keys(self):
+        decoder = self.json.decoder.JSONDecoder(cache_keys=True,
+                                                strict=False)
+        docs = ['{"id": 1, "n\xe9": [{"id": 2}], "x\\"y": 3}',
+                '{"n\xe9": 4, "x\\"y": 5, "id": 6, "new": {}}',
+                '{"\\u20ac": 7, "id": 8}',
+                '[{"id": 9}, {"ctl\x01": 10}]']
+        values = [decoder.decode(doc) for doc in docs]
+        self.assertEqual(values, [self.loads(doc, strict=False)
+                                  for doc in docs])
+        ids = [next(k for k in d if k == 'id') for d in values[:3]]
+        self.assertIs(ids[0], ids[1])
+        self.assertIs(ids[0], ids[2])
+        # Many distinct keys evict each other but decode correctly.
+        doc = self.json.dumps({'key%d' % i: i for i in range(2000)})
+        for _ in range(2):
+            self.assertEqual(decoder.decode(doc), self.loads(doc))
+        self.assertRaises(self.JSONDecodeError, decoder.decode, '{"id')
+        strict = self.json.decoder.JSONDecoder(cache_keys=True)
+        self.assertRaises(self.JSONDecodeError, strict.decode, '{"a\x01": 1}')
+        self.assertEqual(self.loads('{"id": 1}', cache_keys=True), {'id': 1})
+
     def test_extra_data(self):
         s = '[1, 2, 3]5'
         msg = 'Extra data'
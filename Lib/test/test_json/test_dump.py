@@ -12,6 +12,38 @@ def test_dump(self):
     def test_dumps(self):
         self.assertEqual(self.dumps({}), '{}')
 
+    def test_dump_large(self):
+        # Big enough for the C encoder to write several chunks.
+        obj = [{'id': i, 'x': i / 7, 'name': 'n\xe9\u20ac"%d"' % i,
+                'ok': i % 2 == 0, 'none': None} for i in range(20000)]
+        for kwargs in {}, {'ensure_ascii': False}, {'indent': 1}:
+            with self.subTest(**kwargs):
+                chunks = []
+                class F:
+                    write = chunks.append
+                self.json.dump(obj, F, **kwargs)
+                self.assertEqual(''.join(chunks),
+                                 self.dumps(obj, **kwargs))
+                self.assertEqual(self.json.loads(''.join(chunks)), obj)
+
+    def test_dump_write_error(self):
+        class F:
+            def write(self, chunk):
+                raise OSError
+        with self.assertRaises(OSError):
+            self.json.dump(list(range(100000)), F())
+
+    def test_dumps_numbers(self):
+        class I(int):
+            def __repr__(self):
+                return 'I'
+        class F(float):
+            def __repr__(self):
+                return 'F'
+        self.assertEqual(self.dumps([I(-12), F(2.5), 10**30, -0.0, 1e300,
+                                     2**-1074]),
+                         '[-12, 2.5, %d, -0.0, 1e+300, 5e-324]' % 10**30)
+
     def test_dump_skipkeys(self):
         v = {b'invalid_key': False, 'valid_key': True}
         with self.assertRaises(TypeError):
@@ -1,3 +1,4 @@
+import io
 import math
 from test.test_json import PyTest, CTest
 
@@ -28,6 +29,20 @@ def test_allow_nan(self):
                 self.assertNotEqual(res[0], res[0])
             self.assertRaises(ValueError, self.dumps, [val], allow_nan=False)
 
+    def test_allow_nan_error_message(self):
+        for val in (float('inf'), float('-inf'), float('nan')):
+            msg = ('Out of range float values are not JSON compliant: ' +
+                   repr(val))
+            for kwargs in {}, {'indent': 2}:
+                with self.subTest(val=val, **kwargs):
+                    with self.assertRaises(ValueError) as cm:
+                        self.dumps([val], allow_nan=False, **kwargs)
+                    self.assertEqual(str(cm.exception), msg)
+                    with self.assertRaises(ValueError) as cm:
+                        self.json.dump([val], io.StringIO(), allow_nan=False,
+                                       **kwargs)
+                    self.assertEqual(str(cm.exception), msg)
+
 
 class TestPyFloat(TestFloat, PyTest): pass
 class TestCFloat(TestFloat, CTest): pass
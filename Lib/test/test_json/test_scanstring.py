@@ -85,6 +85,26 @@ def test_scanstring(self):
             scanstring('["Bad value", truth]', 2, True),
             ('Bad value', 12))
 
+    def test_scanstring_long(self):
+        # Quotes, escapes and control characters at every position of the
+        # blocks of 16 characters searched at once.
+        scanstring = self.json.decoder.scanstring
+        for n in range(40):
+            prefix = 'a\xe9' * (n // 2) + 'b' * (n % 2)
+            with self.subTest(n=n):
+                self.assertEqual(scanstring('"%s" x' % prefix, 1, True),
+                                 (prefix, n + 2))
+                self.assertEqual(scanstring('"%s\\n%s"' % (prefix, prefix),
+                                            1, True),
+                                 (prefix + '\n' + prefix, 2 * n + 4))
+                self.assertEqual(scanstring('"%s\x1f%s"' % (prefix, prefix),
+                                            1, False),
+                                 (prefix + '\x1f' + prefix, 2 * n + 3))
+                self.assertRaises(self.JSONDecodeError, scanstring,
+                                  '"%s\x7f\x1f"' % prefix, 1, True)
+                self.assertRaises(self.JSONDecodeError, scanstring,
+                                  '"%s' % prefix, 1, True)
+
     def test_surrogates(self):
         scanstring = self.json.decoder.scanstring
         def assertScan(given, expect):
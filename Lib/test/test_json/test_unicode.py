@@ -79,6 +79,65 @@ def test_bytes_decode(self):
         self.assertEqual(self.loads(b'\x007'), 7)
         self.assertEqual(self.loads(b'57'), 57)
 
+    def test_utf8_decode(self):
+        # UTF-8 bytes are parsed without decoding them to str first.
+        docs = [
+            '{"a\xe9": [1, -0, 2.5, -1e-3, 12345678901234567890, 1E400]}',
+            '[true, false, null, NaN, -Infinity, "", "\\"\\\\\\/\\b\\f\\n\\r\\t"]',
+            '{"a": {"b": [{}, []]}, "\u20ac": "\U0001d120 x\\u20acy\\u00e9"}',
+            '"z\\ud834\\udd20x\\ud834\\u0079\\udd20"',
+            ' \t\n[ 1 , {"k" :"v" } ]\r\n',
+            '"%s"' % ('x\xe9\u20ac' * 1000),
+        ]
+        for doc in docs:
+            with self.subTest(doc=doc[:40]):
+                expected = self.loads(doc)
+                self.assertEqual(repr(self.loads(doc.encode())),
+                                 repr(expected))
+                self.assertEqual(repr(self.loads(bytearray(doc.encode()))),
+                                 repr(expected))
+                self.assertEqual(
+                    self.loads(doc.encode(), object_pairs_hook=list,
+                               parse_int=str, parse_float=str),
+                    self.loads(doc, object_pairs_hook=list,
+                               parse_int=str, parse_float=str))
+        self.assertEqual(self.loads(b'{"a": 1, "b": [{"a": 2}]}',
+                                    cache_keys=True),
+                         {'a': 1, 'b': [{'a': 2}]})
+        # Encoded surrogates are accepted like before.
+        self.assertEqual(self.loads(b'["\xed\xa0\xb4"]'), ['\ud834'])
+        self.assertEqual(self.loads(b'"a\x01"', strict=False), 'a\x01')
+        self.assertRaises(UnicodeDecodeError, self.loads, b'["\\n\xff"]')
+        self.assertRaises(UnicodeDecodeError, self.loads, b'["\xc3"]')
+        # Hooks and parse functions are called once per value, even when
+        # the document must be decoded to str.
+        for doc in [b'[{"a": 1.5}]', b'[{"a": 1.5}, "\xed\xa0\xb4"]',
+                    b'[{"a": 1.5}, NaN, x]']:
+            with self.subTest(doc=doc):
+                calls = []
+                def hook(obj, name):
+                    calls.append(name)
+                    return obj
+                try:
+                    self.loads(doc,
+                               object_hook=lambda o: hook(o, 'object'),
+                               parse_float=lambda s: hook(s, 'float'),
+                               parse_constant=lambda s: hook(s, 'constant'))
+                except self.JSONDecodeError:
+                    pass
+                self.assertEqual(calls, ['float', 'object'] +
+                                 ['constant'] * (b'NaN' in doc))
+        # Errors are reported at the same position as for str.
+        for doc in ['[1, 2', '{"a" 1}', '["\xe9\\x"]', '"\xe9\x01"',
+                    '[1] x', '{"\xe9": -}', '[\xe9]', '']:
+            with self.subTest(doc=doc):
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    self.loads(doc)
+                with self.assertRaises(self.JSONDecodeError) as cmb:
+                    self.loads(doc.encode())
+                self.assertEqual(cmb.exception.msg, cm.exception.msg)
+                self.assertEqual(cmb.exception.pos, cm.exception.pos)
+
     def test_object_pairs_hook_with_unicode(self):
         s = '{"xkd":1, "kcw":2, "art":3, "hxm":4, "qrt":5, "pad":6, "hoy":7}'
         p = [("xkd", 1), ("kcw", 2), ("art", 3), ("hxm", 4),
@@ -1,5 +1,6 @@
 import unittest
 from test import support
+from test.support import import_helper
 
 import sys
 
@@ -12,6 +13,9 @@
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+BURNIKEL_ZIEGLER_CUTOFF = 200   # from longobject.c
+TOOM3_CUTOFF = 250   # from longobject.c
+NTT_CUTOFF = 2500   # from longobject.c
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -206,6 +210,34 @@ def test_division(self):
 
 
 
+    def test_burnikel_ziegler(self):
+        # Divisors and quotients of at least BURNIKEL_ZIEGLER_CUTOFF digits
+        # use recursive division.
+        digits = [BURNIKEL_ZIEGLER_CUTOFF, BURNIKEL_ZIEGLER_CUTOFF + 1,
+                  BURNIKEL_ZIEGLER_CUTOFF * 3 + 7, BURNIKEL_ZIEGLER_CUTOFF * 10]
+        for leny in digits:
+            for lenq in digits:
+                y = self.getran(leny) or 1
+                self.check_division(self.getran(leny + lenq), y)
+                # quotients with many all-ones digits, and remainders close
+                # to the divisor
+                q = (1 << (lenq * SHIFT)) - 1
+                self.check_division(q * y + abs(y) - 1, y)
+                self.check_division(q * y - abs(y) + 1, y)
+                self.check_division((1 << ((leny + lenq) * SHIFT)) - 1,
+                                    (1 << (leny * SHIFT - 1)) + 1)
+        # divisors of odd bit length, and powers of two
+        for bits in 7001, 7002, 15003:
+            y = (1 << bits) - 12345
+            self.check_division((1 << (3 * bits)) - 1, y)
+            self.check_division(1 << (3 * bits), 1 << bits)
+        # modular arithmetic
+        m = self.getran(BURNIKEL_ZIEGLER_CUTOFF * 2) or 1
+        x = self.getran(BURNIKEL_ZIEGLER_CUTOFF * 3)
+        y = self.getran(BURNIKEL_ZIEGLER_CUTOFF * 3)
+        self.assertEqual(x * y % m, (x % m) * (y % m) % m)
+        self.assertEqual(pow(x, 5, m), x**5 % m)
+
     def test_karatsuba(self):
         digits = list(range(1, 5)) + list(range(KARATSUBA_CUTOFF,
                                                 KARATSUBA_CUTOFF + 10))
@@ -229,6 +261,47 @@ def test_karatsuba(self):
                          1)
                     self.assertEqual(x, y)
 
+    def test_toom3_ntt(self):
+        # Products of at least TOOM3_CUTOFF and NTT_CUTOFF digits use
+        # Toom-3 and number-theoretic transform multiplication.
+        digits = [TOOM3_CUTOFF, TOOM3_CUTOFF + 1, TOOM3_CUTOFF * 3 + 7,
+                  NTT_CUTOFF, NTT_CUTOFF + 1, NTT_CUTOFF * 3 + 7]
+        for lena in digits:
+            a = self.getran(lena)
+            self.assertEqual(a * a, a ** 2)
+            self.assertEqual(a * a, (-a) * (-a))
+            for lenb in digits:
+                b = self.getran(lenb)
+                with self.subTest(lena=lena, lenb=lenb):
+                    x = a * b
+                    self.assertEqual(x, b * a)
+                    self.assertEqual(-x, (-a) * b)
+                    if b:
+                        self.assertEqual(divmod(x, b), (a, 0))
+                    # (2**a-1)*(2**b-1) has digits that are all ones
+                    abits, bbits = lena * SHIFT, lenb * SHIFT
+                    self.assertEqual(((1 << abits) - 1) * ((1 << bbits) - 1),
+                                     (1 << (abits + bbits)) - (1 << abits) -
+                                     (1 << bbits) + 1)
+
+    @support.cpython_only
+    def test_mul_algorithms(self):
+        _testinternalcapi = import_helper.import_module('_testinternalcapi')
+        mul = _testinternalcapi.long_mul_with_algorithm
+        for lena, lenb in [(1, 1), (5, 300), (TOOM3_CUTOFF, TOOM3_CUTOFF),
+                           (TOOM3_CUTOFF + 3, TOOM3_CUTOFF * 2 - 1),
+                           (NTT_CUTOFF // 2, NTT_CUTOFF + 11)]:
+            a = self.getran(lena)
+            b = self.getran(lenb)
+            expected = mul(a, b, 0)
+            for algorithm in range(1, 4):
+                with self.subTest(lena=lena, lenb=lenb, algorithm=algorithm):
+                    self.assertEqual(mul(a, b, algorithm), expected)
+                    self.assertEqual(mul(a, a, algorithm), mul(a, a, 0))
+                    self.assertEqual(mul(0, b, algorithm), 0)
+        self.assertRaises(ValueError, mul, 2, 3, 4)
+        self.assertRaises(ValueError, mul, 2, 3, -1)
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
@@ -321,6 +394,42 @@ def test_format(self):
                 x = self.getran(lenx)
                 self.check_format_1(x)
 
+    def test_huge_decimal_conversion(self):
+        # Large ints are converted to and from decimal by divide-and-conquer
+        # algorithms.  Check them against conversions done in 1000-digit
+        # chunks.
+        def chunked_str(x):
+            chunks = []
+            while x >= 10**1000:
+                x, r = divmod(x, 10**1000)
+                chunks.append(str(r).zfill(1000))
+            chunks.append(str(x))
+            return ''.join(reversed(chunks))
+
+        def chunked_int(s):
+            x = int(s[:len(s) % 1000 or 1000])
+            for i in range(len(s) % 1000 or 1000, len(s), 1000):
+                x = x * 10**1000 + int(s[i:i+1000])
+            return x
+
+        for ndigits in 5000, 40000:
+            values = [10**ndigits, 10**ndigits - 1, 10**ndigits + 1,
+                      2**int(ndigits * 3.33),
+                      random.randrange(10**(ndigits - 1), 10**ndigits)]
+            for x in values:
+                with self.subTest(ndigits=ndigits, x=hex(x % 2**64)):
+                    s = chunked_str(x)
+                    self.assertEqual(str(x), s)
+                    self.assertEqual(str(-x), '-' + s)
+                    self.assertEqual(int(s), x)
+                    self.assertEqual(chunked_int(s), x)
+                    self.assertEqual(int(' -' + s + ' '), -x)
+                    self.assertEqual(int('_'.join(s)), x)
+                    self.assertEqual(int('0' * 1000 + s), x)
+        self.assertRaises(ValueError, int, '1' * 100000 + '_')
+        self.assertRaises(ValueError, int, '1' * 100000 + 'x')
+        self.assertRaises(ValueError, int, '1' * 50000 + '__' + '1' * 50000)
+
     def test_long(self):
         # Check conversions from string
         LL = [
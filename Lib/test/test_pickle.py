@@ -274,10 +274,10 @@ class SizeofTests(unittest.TestCase):
         check_sizeof = support.check_sizeof
 
         def test_pickler(self):
-            basesize = support.calcobjsize('7P2n3i2n3i2P')
+            basesize = support.calcobjsize('7P2n3i2n4i2Pn256s')
             p = _pickle.Pickler(io.BytesIO())
             self.assertEqual(object.__sizeof__(p), basesize)
-            MT_size = struct.calcsize('3nP0n')
+            MT_size = struct.calcsize('3ni2P0n')
             ME_size = struct.calcsize('Pn0P')
             check = self.check_sizeof
             check(p, basesize +
@@ -289,6 +289,10 @@ def test_pickler(self):
                 MT_size + 32 * ME_size +  # Size of memo table required to
                                           # save references to 6 objects.
                 0)  # Write buffer is cleared after every dump().
+            # The memo only grows with the number of distinct objects.
+            p = _pickle.Pickler(io.BytesIO())
+            p.dump([[], {}] * 100_000)
+            check(p, basesize + MT_size + 8 * ME_size)
 
         def test_unpickler(self):
             basesize = support.calcobjsize('2P2n2P 2P2n2i5P 2P3n8P2n2i')
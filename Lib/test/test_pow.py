@@ -144,6 +144,36 @@ def test_negative_exponent(self):
                         with self.assertRaises(ValueError):
                             pow(a, -1001, m)
 
+    def test_modular(self):
+        # Odd moduli use Montgomery multiplication, even ones plain
+        # reduction; compare both with a straightforward square-and-multiply.
+        def binary_pow(a, e, m):
+            result = 1
+            a %= m
+            while e:
+                if e & 1:
+                    result = result * a % m
+                a = a * a % m
+                e >>= 1
+            return result
+
+        for bits in 20, 30, 31, 61, 200, 1024, 4097, 16000:
+            for m in ((1 << bits) - 1, (1 << bits) + 1, (1 << bits) + 2,
+                      3 ** (bits // 2 + 1), 3 ** (bits // 2) * 2):
+                for a in (0, 1, 2, m - 1, m, m + 1, m * 7 + 5,
+                          5 ** (bits // 3 + 7)):
+                    for e in (4, 5, 23, 24, 80, 1 << 240, (1 << 672) - 1,
+                              7 ** 300, m):
+                        if bits > 200 and e > 1 << 100:
+                            continue
+                        with self.subTest(bits=bits, m=m, a=a, e=e):
+                            expected = binary_pow(a, e, m)
+                            self.assertEqual(pow(a, e, m), expected)
+                            self.assertEqual(pow(a, e, -m),
+                                             expected and expected - m)
+                            self.assertEqual(pow(-a, e, m),
+                                             binary_pow(-a, e, m))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -362,6 +362,28 @@ def test_unsafe_float_compare(self):
         check_against_PyObject_RichCompareBool(self, [float(x) for
                                                       x in range(100)])
 
+    def test_unboxed_long_compare(self):
+        # Long enough lists are sorted by the unboxed values; equal values
+        # must still keep their order, which is checked by identity.
+        for n in 64, 100, 1000:
+            L = [random.randrange(-2**30 + 1, 2**30) for _ in range(n)]
+            L += [0, -0, 2**30 - 1, -2**30 + 1] * 10
+            L += [int(str(x)) for x in L[:50]]
+            check_against_PyObject_RichCompareBool(self, L)
+            self.assertEqual(sorted(L, reverse=True),
+                             sorted(L)[::-1])
+
+    def test_unboxed_float_compare(self):
+        for n in 64, 100, 1000:
+            L = [random.uniform(-1e6, 1e6) for _ in range(n)]
+            L += [0.0, -0.0, float('inf'), float('-inf'), 5e-324] * 10
+            L += [float(repr(x)) for x in L[:50]]
+            check_against_PyObject_RichCompareBool(self, L)
+            L.append(float('nan'))
+            check_against_PyObject_RichCompareBool(self, L)
+        L = [float('nan')] * 10 + [1.0, 0.0] * 100
+        check_against_PyObject_RichCompareBool(self, L)
+
     def test_unsafe_tuple_compare(self):
         # This test was suggested by Tim Peters. It verifies that the tuple
         # comparison respects the current tuple compare semantics, which do not
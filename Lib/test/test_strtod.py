@@ -212,6 +212,36 @@ def test_bigcomp(self):
                 s = '{}e{}'.format(digits, exponent)
                 self.check_strtod(s)
 
+    def test_truncated_significands(self):
+        # float() rounds the leading 19 significant digits up and down and
+        # is done if both agree; try values just around halfway cases,
+        # where they don't.
+        for i in range(10 * TEST_SIZE):
+            e, m = divmod(random.randrange(1, 2047*2**52), 2**52)
+            if e:
+                m, e = m + 2**52, e - 1
+            m, e = 2*m + 1, e - 1075
+            if e >= 0:
+                digits, exponent = str(m << e), 0
+            else:
+                digits, exponent = str(m * 5**-e), e
+            for keep in 19, 20, 25:
+                if len(digits) <= keep:
+                    continue
+                head = int(digits[:keep])
+                for n in head - 1, head, head + 1:
+                    s = '{}e{}'.format(n, exponent + len(digits) - keep)
+                    self.check_strtod(s)
+
+    def test_exponent_limits(self):
+        # decimal exponents where the table used for up to 19 digits ends,
+        # and where results overflow or underflow
+        for exponent in -365, -343, -342, -341, -325, -324, 289, 307, 308, 309:
+            for ndigs in 1, 10, 19, 20:
+                for i in range(TEST_SIZE):
+                    digits = random.randrange(10**(ndigs - 1), 10**ndigs)
+                    self.check_strtod('{}e{}'.format(digits, exponent))
+
     def test_parsing(self):
         # make '0' more likely to be chosen than other digits
         digits = '000000123456789'
@@ -417,6 +417,84 @@ def test_unpack_from(self):
         self.assertEqual(s.unpack_from(buffer=test_string, offset=2),
                          (b'cd01',))
 
+    def test_unpack_repeated(self):
+        # Runs of repeated codes unpack like decoding each item on its own.
+        data = bytes(range(256)) * 2
+        for byteorder in byteorders:
+            order = {'<': 'little', '>': 'big', '!': 'big'}.get(byteorder,
+                                                              sys.byteorder)
+            for code in integer_codes + ('c', '?', 'f', 'd'):
+                if byteorder not in ('', '@') and code in 'nN':
+                    continue
+                with self.subTest(byteorder=byteorder, code=code):
+                    size = struct.calcsize(byteorder + code)
+                    for start in range(size):
+                        n = (len(data) - start) // size
+                        expected = []
+                        for i in range(start, start + n * size, size):
+                            item = data[i:i + size]
+                            if code == 'c':
+                                expected.append(item)
+                            elif code == '?':
+                                expected.append(item != b'\0')
+                            elif code in 'fd':
+                                if order != sys.byteorder:
+                                    item = item[::-1]
+                                expected.append(array.array(code, item)[0])
+                            else:
+                                expected.append(int.from_bytes(
+                                    item, order, signed=code.islower()))
+                        fmt = '%s%d%s' % (byteorder, n, code)
+                        got = struct.unpack_from(fmt, data, start)
+                        self.assertEqual(repr(got), repr(tuple(expected)))
+
+        # Runs mixed with strings, padding and alignment.
+        def le(value, size, signed=False):
+            return value.to_bytes(size, 'little', signed=signed)
+        def be(value, size, signed=False):
+            return value.to_bytes(size, 'big', signed=signed)
+        def native(value, size, signed=False):
+            return value.to_bytes(size, sys.byteorder, signed=signed)
+        double = array.array('d', [2.5]).tobytes()
+        float_be = array.array('f', [-0.75])
+        if sys.byteorder == 'little':
+            float_be.byteswap()
+        float_be = float_be.tobytes()
+        # Native padding before an int and before a double.
+        int_pad = struct.calcsize('@bi') - 5
+        double_pad = struct.calcsize('@b2ixd') - struct.calcsize('@b2ix') - 8
+        for fmt, data, expected in [
+            ('<3s2hx2p2I',
+             b'abc' + le(1, 2) + le(-2, 2, True) + b'\xff' + b'\x01z' +
+             le(7, 4) + le(2**32 - 1, 4),
+             (b'abc', 1, -2, b'z', 7, 2**32 - 1)),
+            ('>2x3H?f',
+             b'\0\0' + be(1, 2) + be(2, 2) + be(65535, 2) + b'\x02' +
+             float_be,
+             (1, 2, 65535, True, -0.75)),
+            ('!q3xQ',
+             be(-3, 8, True) + b'xyz' + be(2**64 - 2, 8),
+             (-3, 2**64 - 2)),
+            ('=2b5x2l',
+             b'\x80\x7f' + b'\0' * 5 + native(-5, 4, True) +
+             native(6, 4, True),
+             (-128, 127, -5, 6)),
+            ('@b2ixd',
+             b'\x05' + b'\0' * int_pad + native(-1, 4, True) +
+             native(9, 4, True) + b'\0' + b'\0' * double_pad + double,
+             (5, -1, 9, 2.5)),
+            ('@3s2i',
+             b'abc' + b'\0' * (int_pad - 2) +
+             native(10, 4, True) + native(-10, 4, True),
+             (b'abc', 10, -10)),
+        ]:
+            with self.subTest(fmt=fmt):
+                s = struct.Struct(fmt)
+                self.assertEqual(s.size, len(data))
+                self.assertEqual(s.unpack(data), expected)
+                self.assertEqual(list(s.iter_unpack(data * 3)), [expected] * 3)
+                self.assertEqual(s.unpack(s.pack(*expected)), expected)
+
     def test_pack_into(self):
         test_string = b'Reykjavik rocks, eow!'
         writable_buf = array.array('b', b' '*100)
@@ -562,7 +640,7 @@ def check_sizeof(self, format_str, number_of_codes):
         # The size of 'PyStructObject'
         totalsize = support.calcobjsize('2n3P')
         # The size taken up by the 'formatcode' dynamic array
-        totalsize += struct.calcsize('P3n0P') * (number_of_codes + 1)
+        totalsize += struct.calcsize('P3n2i0P') * (number_of_codes + 1)
         support.check_sizeof(self, struct.Struct(format_str), totalsize)
 
     @support.cpython_only
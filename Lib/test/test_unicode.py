@@ -1748,6 +1748,72 @@ def test_utf8_decode_valid_sequences(self):
             self.assertEqual(seq.decode('utf-8'), res)
 
 
+    def test_utf8_decode_long(self):
+        # Long inputs are sized by a scan of the whole data and decoded in
+        # 16-byte blocks of ASCII; put characters of each width at every
+        # offset around the block boundaries.
+        for char in '\x80', '\xff', '\u0100', '\uffff', '\U00010000':
+            for prefix in range(0, 40):
+                for suffix in 0, 1, 15, 16, 17, 40:
+                    text = 'a' * prefix + char + 'b' * suffix
+                    with self.subTest(char=char, prefix=prefix, suffix=suffix):
+                        self.assertEqual(text.encode('utf-8').decode('utf-8'),
+                                         text)
+                        text = text + '\xe9' + text
+                        self.assertEqual(text.encode('utf-8').decode('utf-8'),
+                                         text)
+        for bad in (b'\x80', b'\xc0\x80', b'\xed\xa0\x80',
+                    b'\xf4\x90\x80\x80', b'\xe2\x82'):
+            for prefix in range(0, 40, 3):
+                for char in '', '\xff', '\u20ac', '\U0001F600':
+                    data = (b'a' * prefix + char.encode('utf-8') + bad +
+                            b'z' * 20)
+                    start = prefix + len(char.encode('utf-8'))
+                    with self.subTest(bad=bad, prefix=prefix, char=char):
+                        with self.assertRaises(UnicodeDecodeError) as cm:
+                            data.decode('utf-8')
+                        self.assertEqual(cm.exception.start, start)
+                        bad_text = bad.decode('utf-8', 'replace')
+                        self.assertEqual(data.decode('utf-8', 'replace'),
+                                         'a' * prefix + char + bad_text +
+                                         'z' * 20)
+
+    def test_utf8_encode_long(self):
+        # ASCII runs are encoded and scanned for the maximum character 16
+        # characters at a time; put characters of each width at every
+        # offset around the block boundaries.
+        def utf8(text):
+            result = bytearray()
+            for ch in map(ord, text):
+                if ch < 0x80:
+                    result.append(ch)
+                elif ch < 0x800:
+                    result += bytes([0xC0 | ch >> 6, 0x80 | ch & 0x3F])
+                elif ch < 0x10000:
+                    result += bytes([0xE0 | ch >> 12, 0x80 | ch >> 6 & 0x3F,
+                                     0x80 | ch & 0x3F])
+                else:
+                    result += bytes([0xF0 | ch >> 18, 0x80 | ch >> 12 & 0x3F,
+                                     0x80 | ch >> 6 & 0x3F, 0x80 | ch & 0x3F])
+            return bytes(result)
+
+        for wide in '', '\xff', '\u20ac', '\U0001F600':
+            for char in '\x80', '\xff', '\u0100', '\uffff', '\U00010000':
+                for prefix in range(0, 70, 3):
+                    text = wide + 'a' * prefix + char + 'b' * 20
+                    with self.subTest(wide=wide, char=char, prefix=prefix):
+                        self.assertEqual(text.encode('utf-8'), utf8(text))
+                        # slicing computes the maximum character
+                        self.assertEqual(text[len(wide):],
+                                         ''.join(list(text[len(wide):])))
+                        self.assertEqual(text[len(wide):-21],
+                                         ''.join(list(text[len(wide):-21])))
+            text = wide + 'a' * 100 + '\udc80' + 'b' * 30
+            self.assertEqual(text.encode('utf-8', 'surrogateescape'),
+                             utf8(wide) + b'a' * 100 + b'\x80' + b'b' * 30)
+            self.assertEqual(text.encode('utf-8', 'backslashreplace'),
+                             utf8(wide) + b'a' * 100 + b'\\udc80' + b'b' * 30)
+
     def test_utf8_decode_invalid_sequences(self):
         # continuation bytes in a sequence of 2, 3, or 4 bytes
         continuation_bytes = [bytes([x]) for x in range(0x80, 0xC0)]
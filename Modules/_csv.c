@@ -10,7 +10,13 @@ module instead.
 
 #define MODULE_VERSION "1.0"
 
+#if !defined(Py_BUILD_CORE_BUILTIN) && !defined(Py_BUILD_CORE_MODULE)
+#  error "Py_BUILD_CORE_BUILTIN or Py_BUILD_CORE_MODULE must be defined"
+#endif
+
 #include "Python.h"
+#include "pycore_bitutils.h"      // _Py_ctz32()
+#include "pycore_simd.h"          // _Py_HAVE_SSE2
 #include "structmember.h"         // PyMemberDef
 #include <stdbool.h>
 
@@ -109,6 +115,9 @@ typedef struct {
     DialectObj *dialect;    /* parsing dialect */
 
     PyObject *fields;           /* field list for current record */
+    PyObject *columns;          /* column lists filled by read_columns() */
+    Py_ssize_t column;          /* column of the next field */
+    PyObject *error;            /* csv.Error held back by read_columns() */
     ParserState state;          /* current CSV parse state */
     Py_UCS4 *field;             /* temporary buffer */
     Py_ssize_t field_size;      /* size of allocated buffer */
@@ -566,16 +575,12 @@ _call_dialect(_csvstate *module_state, PyObject *dialect_inst, PyObject *kwargs)
 /*
  * READER
  */
+/* Append field to the current record, stealing the reference. */
 static int
-parse_save_field(ReaderObj *self)
+parse_append_field(ReaderObj *self, PyObject *field)
 {
-    PyObject *field;
-
-    field = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
-                                      (void *) self->field, self->field_len);
     if (field == NULL)
         return -1;
-    self->field_len = 0;
     if (self->numeric_field) {
         PyObject *tmp;
 
@@ -586,6 +591,19 @@ parse_save_field(ReaderObj *self)
             return -1;
         field = tmp;
     }
+    if (self->columns != NULL) {
+        /* Surplus fields are only counted; read_columns() reports the
+           mismatch once the record is complete. */
+        Py_ssize_t column = self->column++;
+        if (column < PyList_GET_SIZE(self->columns) &&
+            PyList_Append(PyList_GET_ITEM(self->columns, column), field) < 0)
+        {
+            Py_DECREF(field);
+            return -1;
+        }
+        Py_DECREF(field);
+        return 0;
+    }
     if (PyList_Append(self->fields, field) < 0) {
         Py_DECREF(field);
         return -1;
@@ -594,6 +612,19 @@ parse_save_field(ReaderObj *self)
     return 0;
 }
 
+static int
+parse_save_field(ReaderObj *self)
+{
+    PyObject *field;
+
+    field = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
+                                      (void *) self->field, self->field_len);
+    if (field == NULL)
+        return -1;
+    self->field_len = 0;
+    return parse_append_field(self, field);
+}
+
 static int
 parse_grow_buff(ReaderObj *self)
 {
@@ -611,21 +642,45 @@ parse_grow_buff(ReaderObj *self)
     return 1;
 }
 
+static int
+parse_field_limit_error(_csvstate *module_state)
+{
+    PyErr_Format(module_state->error_obj,
+                 "field larger than field limit (%ld)",
+                 module_state->field_limit);
+    return -1;
+}
+
 static int
 parse_add_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 {
-    if (self->field_len >= module_state->field_limit) {
-        PyErr_Format(module_state->error_obj,
-                     "field larger than field limit (%ld)",
-                     module_state->field_limit);
-        return -1;
-    }
+    if (self->field_len >= module_state->field_limit)
+        return parse_field_limit_error(module_state);
     if (self->field_len == self->field_size && !parse_grow_buff(self))
         return -1;
     self->field[self->field_len++] = c;
     return 0;
 }
 
+/* Like parse_add_char() for the n characters at s. */
+static int
+parse_add_ucs1(ReaderObj *self, _csvstate *module_state,
+               const Py_UCS1 *s, Py_ssize_t n)
+{
+    if (n > module_state->field_limit - self->field_len)
+        return parse_field_limit_error(module_state);
+    while (self->field_size - self->field_len < n) {
+        if (!parse_grow_buff(self))
+            return -1;
+    }
+    Py_UCS4 *p = self->field + self->field_len;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        p[i] = s[i];
+    }
+    self->field_len += n;
+    return 0;
+}
+
 static int
 parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 {
@@ -811,33 +866,164 @@ parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 static int
 parse_reset(ReaderObj *self)
 {
-    Py_XSETREF(self->fields, PyList_New(0));
-    if (self->fields == NULL)
-        return -1;
+    if (self->columns == NULL) {
+        Py_XSETREF(self->fields, PyList_New(0));
+        if (self->fields == NULL)
+            return -1;
+    }
+    self->column = 0;
     self->field_len = 0;
     self->state = START_RECORD;
     self->numeric_field = 0;
     return 0;
 }
 
-static PyObject *
-Reader_iternext(ReaderObj *self)
+/* Return c if it fits in a byte, else NUL, which never starts a run of
+   ordinary characters anyway. */
+static inline Py_UCS1
+ucs1_or_nul(Py_UCS4 c)
+{
+    return c <= 0xff ? (Py_UCS1)c : 0;
+}
+
+/* Return the index of the first of the n characters at s that is one of the
+   five characters in special, or n if there is none. */
+static Py_ssize_t
+find_special(const Py_UCS1 *s, Py_ssize_t n, const Py_UCS1 *special)
+{
+    Py_ssize_t i = 0;
+#ifdef _Py_HAVE_SSE2
+    const __m128i s0 = _mm_set1_epi8((char)special[0]);
+    const __m128i s1 = _mm_set1_epi8((char)special[1]);
+    const __m128i s2 = _mm_set1_epi8((char)special[2]);
+    const __m128i s3 = _mm_set1_epi8((char)special[3]);
+    const __m128i s4 = _mm_set1_epi8((char)special[4]);
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i m = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(x, s0), _mm_cmpeq_epi8(x, s1)),
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, s2),
+                                      _mm_cmpeq_epi8(x, s3)),
+                         _mm_cmpeq_epi8(x, s4)));
+        int mask = _mm_movemask_epi8(m);
+        if (mask != 0) {
+            return i + _Py_ctz32((uint32_t)mask);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        Py_UCS1 c = s[i];
+        if (c == special[0] || c == special[1] || c == special[2] ||
+            c == special[3] || c == special[4]) {
+            break;
+        }
+    }
+    return i;
+}
+
+/* Parse the UCS1 line from pos on as far as possible without calling
+   parse_process_char() for each character: runs of ordinary characters are
+   copied to the field buffer at once, and unquoted fields that lie within
+   the line are sliced from it directly.  unquoted and quoted are the
+   characters that end a run in either kind of field.  Return the position
+   of the first character left for parse_process_char(), or -1 on error. */
+static Py_ssize_t
+parse_ucs1(ReaderObj *self, _csvstate *module_state, PyObject *lineobj,
+           Py_ssize_t pos, const Py_UCS1 *unquoted, const Py_UCS1 *quoted)
+{
+    DialectObj *dialect = self->dialect;
+    const Py_UCS1 *s = PyUnicode_1BYTE_DATA(lineobj);
+    Py_ssize_t len = PyUnicode_GET_LENGTH(lineobj);
+    Py_ssize_t end;
+    Py_UCS1 c;
+
+    while (pos < len) {
+        c = s[pos];
+        switch (self->state) {
+        case START_RECORD:
+            if (c == '\n' || c == '\r' || c == '\0')
+                return pos;
+            self->state = START_FIELD;
+            /* fallthru */
+        case START_FIELD:
+            if (c == '\n' || c == '\r' || c == '\0' ||
+                (c == dialect->quotechar && dialect->quoting != QUOTE_NONE) ||
+                c == dialect->escapechar ||
+                (c == ' ' && dialect->skipinitialspace) ||
+                c == dialect->delimiter)
+                return pos;
+            /* begin new unquoted field */
+            if (dialect->quoting == QUOTE_NONNUMERIC)
+                self->numeric_field = 1;
+            end = pos + find_special(s + pos, len - pos, unquoted);
+            if (end < len &&
+                (s[end] == '\0' || s[end] == dialect->escapechar)) {
+                /* The field goes on after the escape character (or the
+                   line contains NUL); leave that to the state machine. */
+                self->state = IN_FIELD;
+                if (parse_add_ucs1(self, module_state, s + pos, end - pos) < 0)
+                    return -1;
+                return end;
+            }
+            if (end - pos > module_state->field_limit)
+                return parse_field_limit_error(module_state);
+            if (parse_append_field(self,
+                                   PyUnicode_Substring(lineobj, pos, end)) < 0)
+                return -1;
+            if (end == len) {
+                /* end of line - return [fields] */
+                self->state = START_RECORD;
+                return len;
+            }
+            if (s[end] == '\n' || s[end] == '\r')
+                self->state = EAT_CRNL;
+            else
+                self->state = START_FIELD;
+            pos = end + 1;
+            break;
+
+        case IN_FIELD:
+            end = pos + find_special(s + pos, len - pos, unquoted);
+            if (parse_add_ucs1(self, module_state, s + pos, end - pos) < 0)
+                return -1;
+            return end;
+
+        case IN_QUOTED_FIELD:
+            end = pos + find_special(s + pos, len - pos, quoted);
+            if (parse_add_ucs1(self, module_state, s + pos, end - pos) < 0)
+                return -1;
+            return end;
+
+        default:
+            return pos;
+        }
+    }
+    return pos;
+}
+
+/* Parse the next record into self->fields, or into self->columns while
+   read_columns() is running.  Return 1 if a record was read, 0 at the end
+   of the input and -1 with an exception set on error. */
+static int
+parse_record(ReaderObj *self, _csvstate *module_state)
 {
-    PyObject *fields = NULL;
     Py_UCS4 c;
     Py_ssize_t pos, linelen;
     unsigned int kind;
     const void *data;
     PyObject *lineobj;
-
-    _csvstate *module_state = _csv_state_from_type(Py_TYPE(self),
-                                                   "Reader.__next__");
-    if (module_state == NULL) {
-        return NULL;
-    }
+    DialectObj *dialect = self->dialect;
+    const Py_UCS1 unquoted[5] = {
+        ucs1_or_nul(dialect->delimiter), ucs1_or_nul(dialect->escapechar),
+        '\n', '\r', '\0'
+    };
+    const Py_UCS1 quoted[5] = {
+        ucs1_or_nul(dialect->quotechar), ucs1_or_nul(dialect->escapechar),
+        '\0', '\0', '\0'
+    };
 
     if (parse_reset(self) < 0)
-        return NULL;
+        return -1;
     do {
         lineobj = PyIter_Next(self->input_iter);
         if (lineobj == NULL) {
@@ -848,9 +1034,9 @@ Reader_iternext(ReaderObj *self)
                     PyErr_SetString(module_state->error_obj,
                                     "unexpected end of data");
                 else if (parse_save_field(self) >= 0)
-                    break;
+                    return 1;
             }
-            return NULL;
+            return PyErr_Occurred() ? -1 : 0;
         }
         if (!PyUnicode_Check(lineobj)) {
             PyErr_Format(module_state->error_obj,
@@ -860,39 +1046,85 @@ Reader_iternext(ReaderObj *self)
                          Py_TYPE(lineobj)->tp_name
                 );
             Py_DECREF(lineobj);
-            return NULL;
+            return -1;
         }
         if (PyUnicode_READY(lineobj) == -1) {
             Py_DECREF(lineobj);
-            return NULL;
+            return -1;
         }
         ++self->line_num;
         kind = PyUnicode_KIND(lineobj);
         data = PyUnicode_DATA(lineobj);
         pos = 0;
         linelen = PyUnicode_GET_LENGTH(lineobj);
-        while (linelen--) {
+        while (pos < linelen) {
+            if (kind == PyUnicode_1BYTE_KIND) {
+                pos = parse_ucs1(self, module_state, lineobj, pos,
+                                 unquoted, quoted);
+                if (pos < 0) {
+                    Py_DECREF(lineobj);
+                    return -1;
+                }
+                if (pos == linelen)
+                    break;
+            }
             c = PyUnicode_READ(kind, data, pos);
             if (c == '\0') {
                 Py_DECREF(lineobj);
                 PyErr_Format(module_state->error_obj,
                              "line contains NUL");
-                goto err;
+                return -1;
             }
             if (parse_process_char(self, module_state, c) < 0) {
                 Py_DECREF(lineobj);
-                goto err;
+                return -1;
             }
             pos++;
         }
         Py_DECREF(lineobj);
         if (parse_process_char(self, module_state, 0) < 0)
-            goto err;
+            return -1;
     } while (self->state != START_RECORD);
 
+    return 1;
+}
+
+/* Raise the error of a malformed record that read_columns() held back
+   while it returned the records before it.  Return 0 if there is none. */
+static int
+Reader_raise_error(ReaderObj *self)
+{
+    PyObject *exc = self->error;
+
+    if (exc == NULL)
+        return 0;
+    self->error = NULL;
+    PyErr_SetObject((PyObject *)Py_TYPE(exc), exc);
+    Py_DECREF(exc);
+    return -1;
+}
+
+static PyObject *
+Reader_iternext(ReaderObj *self)
+{
+    PyObject *fields;
+    _csvstate *module_state = _csv_state_from_type(Py_TYPE(self),
+                                                   "Reader.__next__");
+    if (module_state == NULL) {
+        return NULL;
+    }
+    if (self->columns != NULL) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "reader iterated during read_columns()");
+        return NULL;
+    }
+    if (Reader_raise_error(self) < 0)
+        return NULL;
+
+    if (parse_record(self, module_state) <= 0)
+        return NULL;
     fields = self->fields;
     self->fields = NULL;
-err:
     return fields;
 }
 
@@ -916,6 +1148,8 @@ Reader_traverse(ReaderObj *self, visitproc visit, void *arg)
     Py_VISIT(self->dialect);
     Py_VISIT(self->input_iter);
     Py_VISIT(self->fields);
+    Py_VISIT(self->columns);
+    Py_VISIT(self->error);
     Py_VISIT(Py_TYPE(self));
     return 0;
 }
@@ -926,6 +1160,8 @@ Reader_clear(ReaderObj *self)
     Py_CLEAR(self->dialect);
     Py_CLEAR(self->input_iter);
     Py_CLEAR(self->fields);
+    Py_CLEAR(self->columns);
+    Py_CLEAR(self->error);
     return 0;
 }
 
@@ -936,7 +1172,172 @@ PyDoc_STRVAR(Reader_Type_doc,
 "in CSV format.\n"
 );
 
+/* Replace each field of a column with type(field), calling int() and
+   float() on strings directly. */
+static int
+convert_column(PyObject *column, PyObject *type)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < PyList_GET_SIZE(column); i++) {
+        PyObject *field = PyList_GET_ITEM(column, i);
+        PyObject *value;
+
+        Py_INCREF(field);
+        if (type == (PyObject *)&PyLong_Type && PyUnicode_CheckExact(field))
+            value = PyLong_FromUnicodeObject(field, 10);
+        else if (type == (PyObject *)&PyFloat_Type &&
+                 PyUnicode_CheckExact(field))
+            value = PyFloat_FromString(field);
+        else
+            value = PyObject_CallOneArg(type, field);
+        Py_DECREF(field);
+        if (value == NULL || PyList_SetItem(column, i, value) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+PyDoc_STRVAR(Reader_read_columns_doc,
+"read_columns(n=-1, types=None)\n"
+"\n"
+"Read up to n records, or all remaining records if n is negative, and\n"
+"return them as a list of columns, each a list of fields.  Blank lines\n"
+"are skipped and every record must have as many fields as the first.\n"
+"If a later record has a different number of fields or is malformed,\n"
+"the records before it are returned and the next call raises the error.\n"
+"If given, types holds one entry per column: None to keep the fields\n"
+"as parsed, or a callable such as int or float to apply to each field.\n"
+"An empty list is returned at the end of the input.");
+
+static PyObject *
+Reader_read_columns(ReaderObj *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"n", "types", NULL};
+    Py_ssize_t n = -1, nrows = 0, ncolumns = 0, i;
+    PyObject *types = Py_None, *columns;
+    int rc;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|nO:read_columns",
+                                     kwlist, &n, &types))
+        return NULL;
+
+    _csvstate *module_state = _csv_state_from_type(Py_TYPE(self),
+                                                   "Reader.read_columns");
+    if (module_state == NULL) {
+        return NULL;
+    }
+    if (self->columns != NULL) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "read_columns() called recursively");
+        return NULL;
+    }
+    if (Reader_raise_error(self) < 0)
+        return NULL;
+    if (types == Py_None) {
+        types = NULL;
+    }
+    else {
+        types = PySequence_Fast(types, "types must be a sequence or None");
+        if (types == NULL)
+            return NULL;
+    }
+    columns = PyList_New(0);
+    if (columns == NULL)
+        goto error;
+
+    while (n < 0 || nrows < n) {
+        rc = parse_record(self, module_state);
+        if (rc <= 0)
+            break;
+        if (self->columns == NULL) {
+            /* The first record fixes the number of columns; later ones are
+               parsed straight into the column lists. */
+            ncolumns = PyList_GET_SIZE(self->fields);
+            if (ncolumns == 0)
+                continue;
+            if (types != NULL &&
+                PySequence_Fast_GET_SIZE(types) != ncolumns) {
+                PyErr_Format(PyExc_ValueError,
+                             "types has %zd entries, but records have "
+                             "%zd fields",
+                             PySequence_Fast_GET_SIZE(types), ncolumns);
+                goto error;
+            }
+            for (i = 0; i < ncolumns; i++) {
+                PyObject *column = PyList_GetSlice(self->fields, i, i + 1);
+                if (column == NULL)
+                    goto error;
+                if (PyList_Append(columns, column) < 0) {
+                    Py_DECREF(column);
+                    goto error;
+                }
+                Py_DECREF(column);
+            }
+            Py_INCREF(columns);
+            self->columns = columns;
+            /* The fields of the first record now live in the columns. */
+            Py_CLEAR(self->fields);
+        }
+        else if (self->column != ncolumns) {
+            if (self->column == 0)
+                continue;
+            PyErr_Format(module_state->error_obj,
+                         "expected %zd fields, saw %zd (line %lu)",
+                         ncolumns, self->column, self->line_num);
+            break;
+        }
+        nrows++;
+    }
+    Py_CLEAR(self->columns);
+    if (PyErr_Occurred()) {
+        PyObject *type, *value, *tb;
+
+        /* Return the records before a malformed one and keep its error
+           for the next call. */
+        if (nrows == 0 || !PyErr_ExceptionMatches(module_state->error_obj))
+            goto error;
+        PyErr_Fetch(&type, &value, &tb);
+        PyErr_NormalizeException(&type, &value, &tb);
+        if (tb != NULL) {
+            PyException_SetTraceback(value, tb);
+            Py_DECREF(tb);
+        }
+        Py_DECREF(type);
+        self->error = value;
+        /* Drop the fields of the malformed record. */
+        for (i = 0; i < ncolumns; i++) {
+            if (PyList_SetSlice(PyList_GET_ITEM(columns, i), nrows,
+                                PY_SSIZE_T_MAX, NULL) < 0)
+                goto error;
+        }
+    }
+
+    if (types != NULL && nrows > 0) {
+        for (i = 0; i < ncolumns; i++) {
+            PyObject *type = PySequence_Fast_GET_ITEM(types, i);
+            if (type == Py_None)
+                continue;
+            Py_INCREF(type);
+            rc = convert_column(PyList_GET_ITEM(columns, i), type);
+            Py_DECREF(type);
+            if (rc < 0)
+                goto error;
+        }
+    }
+    Py_XDECREF(types);
+    return columns;
+
+error:
+    Py_CLEAR(self->columns);
+    Py_XDECREF(columns);
+    Py_XDECREF(types);
+    return NULL;
+}
+
 static struct PyMethodDef Reader_methods[] = {
+    { "read_columns", (PyCFunction)(void(*)(void))Reader_read_columns,
+        METH_VARARGS | METH_KEYWORDS, Reader_read_columns_doc},
     { NULL, NULL }
 };
 #define R_OFF(x) offsetof(ReaderObj, x)
@@ -983,6 +1384,8 @@ csv_reader(PyObject *module, PyObject *args, PyObject *keyword_args)
 
     self->dialect = NULL;
     self->fields = NULL;
+    self->columns = NULL;
+    self->error = NULL;
     self->input_iter = NULL;
     self->field = NULL;
     self->field_size = 0;
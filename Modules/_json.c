@@ -9,8 +9,9 @@
 #endif
 
 #include "Python.h"
+#include "pycore_bitutils.h"      // _Py_ctz32()
+#include "pycore_simd.h"          // _Py_HAVE_SSE2
 #include "structmember.h"         // PyMemberDef
-#include "pycore_accu.h"
 
 typedef struct {
     PyObject *PyScannerType;
@@ -35,8 +36,12 @@ typedef struct _PyScannerObject {
     PyObject *parse_int;
     PyObject *parse_constant;
     PyObject *memo;
+    PyObject **key_cache;   /* KEY_CACHE_SIZE recent keys, or NULL */
 } PyScannerObject;
 
+/* Number of slots of the key cache; a power of 2 */
+#define KEY_CACHE_SIZE 256
+
 static PyMemberDef scanner_members[] = {
     {"strict", T_BOOL, offsetof(PyScannerObject, strict), READONLY, "strict"},
     {"object_hook", T_OBJECT, offsetof(PyScannerObject, object_hook), READONLY, "object_hook"},
@@ -73,6 +78,16 @@ static PyMemberDef encoder_members[] = {
     {NULL}
 };
 
+/* Output of one encoder call: a single growing string, handed to write()
+   in chunks of about ENCODER_CHUNK_SIZE characters when encoding to a
+   file. */
+typedef struct {
+    _PyUnicodeWriter writer;
+    PyObject *write;
+} EncoderOutput;
+
+#define ENCODER_CHUNK_SIZE (64 * 1024)
+
 /* Forward decls */
 
 static PyObject *
@@ -96,11 +111,11 @@ encoder_dealloc(PyObject *self);
 static int
 encoder_clear(PyEncoderObject *self);
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc, PyObject *seq, Py_ssize_t indent_level);
+encoder_listencode_list(PyEncoderObject *s, EncoderOutput *out, PyObject *seq, Py_ssize_t indent_level);
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc, PyObject *obj, Py_ssize_t indent_level);
+encoder_listencode_obj(PyEncoderObject *s, EncoderOutput *out, PyObject *obj, Py_ssize_t indent_level);
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc, PyObject *dct, Py_ssize_t indent_level);
+encoder_listencode_dict(PyEncoderObject *s, EncoderOutput *out, PyObject *dct, Py_ssize_t indent_level);
 static PyObject *
 _encoded_const(PyObject *obj);
 static void
@@ -375,6 +390,37 @@ _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx) {
     return tpl;
 }
 
+/* Return the index of the first quote, backslash or control character in
+   the Latin-1 data s[start:len], or len if there is none. */
+static Py_ssize_t
+find_string_special(const Py_UCS1 *s, Py_ssize_t start, Py_ssize_t len)
+{
+    Py_ssize_t i = start;
+#ifdef _Py_HAVE_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1f);
+    for (; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i m = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(x, quote),
+                         _mm_cmpeq_epi8(x, backslash)),
+            _mm_cmpeq_epi8(_mm_min_epu8(x, control), x));
+        int mask = _mm_movemask_epi8(m);
+        if (mask != 0) {
+            return i + _Py_ctz32((uint32_t)mask);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        Py_UCS1 c = s[i];
+        if (c == '"' || c == '\\' || c <= 0x1f) {
+            break;
+        }
+    }
+    return i;
+}
+
 static PyObject *
 scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
 {
@@ -415,6 +461,12 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
             // Use tight scope variable to help register allocation.
             Py_UCS4 d = 0;
             for (next = end; next < len; next++) {
+                if (kind == PyUnicode_1BYTE_KIND) {
+                    next = find_string_special(buf, next, len);
+                    if (next == len) {
+                        break;
+                    }
+                }
                 d = PyUnicode_READ(kind, buf, next);
                 if (d == '"' || d == '\\') {
                     break;
@@ -669,9 +721,67 @@ scanner_clear(PyScannerObject *self)
     Py_CLEAR(self->parse_int);
     Py_CLEAR(self->parse_constant);
     Py_CLEAR(self->memo);
+    if (self->key_cache != NULL) {
+        PyObject **key_cache = self->key_cache;
+        self->key_cache = NULL;
+        for (int i = 0; i < KEY_CACHE_SIZE; i++) {
+            Py_XDECREF(key_cache[i]);
+        }
+        PyMem_Free(key_cache);
+    }
     return 0;
 }
 
+static PyObject *
+cached_key(PyScannerObject *s, const Py_UCS1 *data, Py_ssize_t n)
+{
+    /* Return the key made of the n Latin-1 characters at data, from the key
+    cache if it holds that key, else as a new string stored in the cache.
+    */
+    Py_uhash_t hash = 0;
+    PyObject **slot, *key;
+
+    for (Py_ssize_t i = 0; i < n; i++) {
+        hash = (hash ^ data[i]) * 1000003;
+    }
+    slot = &s->key_cache[(hash ^ (hash >> 16)) & (KEY_CACHE_SIZE - 1)];
+    key = *slot;
+    if (key != NULL && PyUnicode_GET_LENGTH(key) == n &&
+        memcmp(PyUnicode_1BYTE_DATA(key), data, n) == 0) {
+        Py_INCREF(key);
+        return key;
+    }
+    key = PyUnicode_DecodeLatin1((const char *)data, n, NULL);
+    if (key == NULL) {
+        return NULL;
+    }
+    Py_INCREF(key);
+    Py_XSETREF(*slot, key);
+    return key;
+}
+
+static PyObject *
+scan_cached_key(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_ssize_t *next_idx_ptr)
+{
+    /* Read an object key from the Latin-1 PyUnicode pystr, like
+    scanstring_unicode(), reusing the string from the key cache if the same
+    key was read recently.  Keys containing escapes are not cached.
+    */
+    const Py_UCS1 *data = PyUnicode_1BYTE_DATA(pystr);
+    Py_ssize_t end;
+    PyObject *key;
+
+    end = find_string_special(data, start, PyUnicode_GET_LENGTH(pystr));
+    if (end == PyUnicode_GET_LENGTH(pystr) || data[end] != '"') {
+        return scanstring_unicode(pystr, start, s->strict, next_idx_ptr);
+    }
+    key = cached_key(s, data + start, end - start);
+    if (key != NULL) {
+        *next_idx_ptr = end + 1;
+    }
+    return key;
+}
+
 static PyObject *
 _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
 {
@@ -718,16 +828,23 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
                 raise_errmsg("Expecting property name enclosed in double quotes", pystr, idx);
                 goto bail;
             }
-            key = scanstring_unicode(pystr, idx + 1, s->strict, &next_idx);
-            if (key == NULL)
-                goto bail;
-            memokey = PyDict_SetDefault(s->memo, key, key);
-            if (memokey == NULL) {
-                goto bail;
+            if (s->key_cache != NULL && kind == PyUnicode_1BYTE_KIND) {
+                key = scan_cached_key(s, pystr, idx + 1, &next_idx);
+                if (key == NULL)
+                    goto bail;
+            }
+            else {
+                key = scanstring_unicode(pystr, idx + 1, s->strict, &next_idx);
+                if (key == NULL)
+                    goto bail;
+                memokey = PyDict_SetDefault(s->memo, key, key);
+                if (memokey == NULL) {
+                    goto bail;
+                }
+                Py_INCREF(memokey);
+                Py_DECREF(key);
+                key = memokey;
             }
-            Py_INCREF(memokey);
-            Py_DECREF(key);
-            key = memokey;
             idx = next_idx;
 
             /* skip whitespace between key and : delimiter, read :, skip whitespace */
@@ -1133,6 +1250,514 @@ scan_once_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_
     return _match_number_unicode(s, pystr, idx, next_idx_ptr);
 }
 
+/* The *_utf8() functions parse JSON from a buffer of UTF-8 bytes the same
+   way the *_unicode() functions above parse a str, creating only the strings
+   in the result.  Indices are byte offsets.  If the document is not valid
+   JSON or not strict UTF-8 (json.loads() accepts encoded surrogates), they
+   return NULL without setting an exception: the caller then decodes the
+   document to str and parses that to report the error. */
+
+static PyObject *
+scan_once_utf8(PyScannerObject *s, const Py_UCS1 *buf, Py_ssize_t len, Py_ssize_t idx, Py_ssize_t *next_idx_ptr);
+
+static PyObject *
+decode_utf8_chunk(const Py_UCS1 *buf, Py_ssize_t n)
+{
+    /* Decode n bytes of strict UTF-8.  Return NULL without an exception set
+    if they are invalid. */
+    PyObject *rval = PyUnicode_DecodeUTF8((const char *)buf, n, NULL);
+    if (rval == NULL && PyErr_ExceptionMatches(PyExc_UnicodeDecodeError)) {
+        PyErr_Clear();
+    }
+    return rval;
+}
+
+static int
+is_ascii(const Py_UCS1 *buf, Py_ssize_t n)
+{
+    Py_UCS1 bits = 0;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        bits |= buf[i];
+    }
+    return bits < 0x80;
+}
+
+static int
+decode_hex4(const Py_UCS1 *buf)
+{
+    /* Return the value of the 4 hex digits at buf, or -1 */
+    int c = 0;
+    for (int i = 0; i < 4; i++) {
+        Py_UCS1 digit = buf[i];
+        c <<= 4;
+        if (digit >= '0' && digit <= '9')
+            c |= digit - '0';
+        else if (digit >= 'a' && digit <= 'f')
+            c |= digit - 'a' + 10;
+        else if (digit >= 'A' && digit <= 'F')
+            c |= digit - 'A' + 10;
+        else
+            return -1;
+    }
+    return c;
+}
+
+static PyObject *
+scanstring_utf8(const Py_UCS1 *buf, Py_ssize_t len, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
+{
+    /* Read the JSON string from UTF-8 buf; see scanstring_unicode() */
+    PyObject *chunk;
+    Py_ssize_t next;
+    _PyUnicodeWriter writer;
+    _PyUnicodeWriter_Init(&writer);
+    writer.overallocate = 1;
+
+    while (1) {
+        /* Find the end of the string or the next escape */
+        Py_UCS4 c;
+        next = find_string_special(buf, end, len);
+        while (next < len && buf[next] <= 0x1f) {
+            if (strict)
+                goto bail;
+            next = find_string_special(buf, next + 1, len);
+        }
+        if (next == len)
+            goto bail;
+        c = buf[next];
+
+        if (c == '"' && writer.buffer == NULL) {
+            // Fast path for simple case.
+            chunk = decode_utf8_chunk(buf + end, next - end);
+            if (chunk != NULL)
+                *next_end_ptr = next + 1;
+            return chunk;
+        }
+        /* Pick up this chunk if it's not zero length */
+        if (next != end) {
+            int rv;
+            chunk = decode_utf8_chunk(buf + end, next - end);
+            if (chunk == NULL)
+                goto bail;
+            rv = _PyUnicodeWriter_WriteStr(&writer, chunk);
+            Py_DECREF(chunk);
+            if (rv < 0)
+                goto bail;
+        }
+        next++;
+        if (c == '"') {
+            end = next;
+            break;
+        }
+        if (next == len)
+            goto bail;
+        c = buf[next];
+        if (c != 'u') {
+            /* Non-unicode backslash escapes */
+            end = next + 1;
+            switch (c) {
+                case '"': break;
+                case '\\': break;
+                case '/': break;
+                case 'b': c = '\b'; break;
+                case 'f': c = '\f'; break;
+                case 'n': c = '\n'; break;
+                case 'r': c = '\r'; break;
+                case 't': c = '\t'; break;
+                default: goto bail;
+            }
+        }
+        else {
+            int hex;
+            end = next + 5;
+            if (end >= len || (hex = decode_hex4(buf + next + 1)) < 0)
+                goto bail;
+            c = hex;
+            /* Surrogate pair */
+            if (Py_UNICODE_IS_HIGH_SURROGATE(c) && end + 6 < len &&
+                buf[end] == '\\' && buf[end + 1] == 'u') {
+                hex = decode_hex4(buf + end + 2);
+                if (hex < 0)
+                    goto bail;
+                if (Py_UNICODE_IS_LOW_SURROGATE(hex)) {
+                    c = Py_UNICODE_JOIN_SURROGATES(c, hex);
+                    end += 6;
+                }
+            }
+        }
+        if (_PyUnicodeWriter_WriteChar(&writer, c) < 0)
+            goto bail;
+    }
+
+    *next_end_ptr = end;
+    return _PyUnicodeWriter_Finish(&writer);
+
+bail:
+    _PyUnicodeWriter_Dealloc(&writer);
+    return NULL;
+}
+
+static PyObject *
+_parse_object_utf8(PyScannerObject *s, const Py_UCS1 *buf, Py_ssize_t len, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
+{
+    /* Read a JSON object from UTF-8 buf; see _parse_object_unicode() */
+    PyObject *val = NULL;
+    PyObject *rval = NULL;
+    PyObject *key = NULL;
+    int has_pairs_hook = (s->object_pairs_hook != Py_None);
+    Py_ssize_t next_idx;
+
+    if (has_pairs_hook)
+        rval = PyList_New(0);
+    else
+        rval = PyDict_New();
+    if (rval == NULL)
+        return NULL;
+
+    /* skip whitespace after { */
+    while (idx < len && IS_WHITESPACE(buf[idx])) idx++;
+
+    /* only loop if the object is non-empty */
+    if (idx >= len || buf[idx] != '}') {
+        while (1) {
+            Py_ssize_t end;
+
+            /* read key; ASCII keys without escapes can be cached */
+            if (idx >= len || buf[idx] != '"')
+                goto bail;
+            end = find_string_special(buf, idx + 1, len);
+            if (s->key_cache != NULL && end < len && buf[end] == '"' &&
+                is_ascii(buf + idx + 1, end - idx - 1)) {
+                key = cached_key(s, buf + idx + 1, end - idx - 1);
+                if (key == NULL)
+                    goto bail;
+                next_idx = end + 1;
+            }
+            else {
+                PyObject *memokey;
+                key = scanstring_utf8(buf, len, idx + 1, s->strict, &next_idx);
+                if (key == NULL)
+                    goto bail;
+                memokey = PyDict_SetDefault(s->memo, key, key);
+                if (memokey == NULL) {
+                    goto bail;
+                }
+                Py_INCREF(memokey);
+                Py_DECREF(key);
+                key = memokey;
+            }
+            idx = next_idx;
+
+            /* skip whitespace between key and : delimiter, read :, skip whitespace */
+            while (idx < len && IS_WHITESPACE(buf[idx])) idx++;
+            if (idx >= len || buf[idx] != ':')
+                goto bail;
+            idx++;
+            while (idx < len && IS_WHITESPACE(buf[idx])) idx++;
+
+            /* read any JSON term */
+            val = scan_once_utf8(s, buf, len, idx, &next_idx);
+            if (val == NULL)
+                goto bail;
+
+            if (has_pairs_hook) {
+                PyObject *item = PyTuple_Pack(2, key, val);
+                if (item == NULL)
+                    goto bail;
+                Py_CLEAR(key);
+                Py_CLEAR(val);
+                if (PyList_Append(rval, item) == -1) {
+                    Py_DECREF(item);
+                    goto bail;
+                }
+                Py_DECREF(item);
+            }
+            else {
+                if (PyDict_SetItem(rval, key, val) < 0)
+                    goto bail;
+                Py_CLEAR(key);
+                Py_CLEAR(val);
+            }
+            idx = next_idx;
+
+            /* skip whitespace before } or , */
+            while (idx < len && IS_WHITESPACE(buf[idx])) idx++;
+
+            /* bail if the object is closed or we didn't get the , delimiter */
+            if (idx < len && buf[idx] == '}')
+                break;
+            if (idx >= len || buf[idx] != ',')
+                goto bail;
+            idx++;
+
+            /* skip whitespace after , delimiter */
+            while (idx < len && IS_WHITESPACE(buf[idx])) idx++;
+        }
+    }
+
+    *next_idx_ptr = idx + 1;
+
+    if (has_pairs_hook) {
+        val = PyObject_CallOneArg(s->object_pairs_hook, rval);
+        Py_DECREF(rval);
+        return val;
+    }
+
+    /* if object_hook is not None: rval = object_hook(rval) */
+    if (s->object_hook != Py_None) {
+        val = PyObject_CallOneArg(s->object_hook, rval);
+        Py_DECREF(rval);
+        return val;
+    }
+    return rval;
+bail:
+    Py_XDECREF(key);
+    Py_XDECREF(val);
+    Py_XDECREF(rval);
+    return NULL;
+}
+
+static PyObject *
+_parse_array_utf8(PyScannerObject *s, const Py_UCS1 *buf, Py_ssize_t len, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
+{
+    /* Read a JSON array from UTF-8 buf; see _parse_array_unicode() */
+    PyObject *val = NULL;
+    PyObject *rval;
+    Py_ssize_t next_idx;
+
+    rval = PyList_New(0);
+    if (rval == NULL)
+        return NULL;
+
+    /* skip whitespace after [ */
+    while (idx < len && IS_WHITESPACE(buf[idx])) idx++;
+
+    /* only loop if the array is non-empty */
+    if (idx >= len || buf[idx] != ']') {
+        while (1) {
+
+            /* read any JSON term  */
+            val = scan_once_utf8(s, buf, len, idx, &next_idx);
+            if (val == NULL)
+                goto bail;
+
+            if (PyList_Append(rval, val) == -1)
+                goto bail;
+
+            Py_CLEAR(val);
+            idx = next_idx;
+
+            /* skip whitespace between term and , */
+            while (idx < len && IS_WHITESPACE(buf[idx])) idx++;
+
+            /* bail if the array is closed or we didn't get the , delimiter */
+            if (idx < len && buf[idx] == ']')
+                break;
+            if (idx >= len || buf[idx] != ',')
+                goto bail;
+            idx++;
+
+            /* skip whitespace after , */
+            while (idx < len && IS_WHITESPACE(buf[idx])) idx++;
+        }
+    }
+
+    /* verify that idx < len, buf[idx] should be ']' */
+    if (idx >= len || buf[idx] != ']')
+        goto bail;
+    *next_idx_ptr = idx + 1;
+    return rval;
+bail:
+    Py_XDECREF(val);
+    Py_DECREF(rval);
+    return NULL;
+}
+
+static PyObject *
+_match_number_utf8(PyScannerObject *s, const Py_UCS1 *buf, Py_ssize_t len, Py_ssize_t start, Py_ssize_t *next_idx_ptr)
+{
+    /* Read a JSON number from UTF-8 buf; see _match_number_unicode() */
+    Py_ssize_t idx = start;
+    int is_float = 0;
+    PyObject *rval;
+    PyObject *numstr;
+    PyObject *custom_func;
+    char small[64];
+
+    /* read a sign if it's there, make sure it's not the end of the string */
+    if (buf[idx] == '-') {
+        idx++;
+        if (idx >= len)
+            return NULL;
+    }
+
+    /* read as many integer digits as we find as long as it doesn't start with 0 */
+    if (buf[idx] >= '1' && buf[idx] <= '9') {
+        idx++;
+        while (idx < len && buf[idx] >= '0' && buf[idx] <= '9') idx++;
+    }
+    /* if it starts with 0 we only expect one integer digit */
+    else if (buf[idx] == '0') {
+        idx++;
+    }
+    /* no integer digits, error */
+    else {
+        return NULL;
+    }
+
+    /* if the next char is '.' followed by a digit then read all float digits */
+    if (idx + 1 < len && buf[idx] == '.' && buf[idx + 1] >= '0' && buf[idx + 1] <= '9') {
+        is_float = 1;
+        idx += 2;
+        while (idx < len && buf[idx] >= '0' && buf[idx] <= '9') idx++;
+    }
+
+    /* if the next char is 'e' or 'E' then maybe read the exponent (or backtrack) */
+    if (idx + 1 < len && (buf[idx] == 'e' || buf[idx] == 'E')) {
+        Py_ssize_t e_start = idx;
+        idx++;
+
+        /* read an exponent sign if present */
+        if (idx + 1 < len && (buf[idx] == '-' || buf[idx] == '+')) idx++;
+
+        /* read all digits */
+        while (idx < len && buf[idx] >= '0' && buf[idx] <= '9') idx++;
+
+        /* if we got a digit, then parse as float. if not, backtrack */
+        if (buf[idx - 1] >= '0' && buf[idx - 1] <= '9') {
+            is_float = 1;
+        }
+        else {
+            idx = e_start;
+        }
+    }
+
+    if (is_float && s->parse_float != (PyObject *)&PyFloat_Type)
+        custom_func = s->parse_float;
+    else if (!is_float && s->parse_int != (PyObject *) &PyLong_Type)
+        custom_func = s->parse_int;
+    else
+        custom_func = NULL;
+
+    *next_idx_ptr = idx;
+    if (custom_func) {
+        numstr = PyUnicode_DecodeASCII((const char *)buf + start,
+                                       idx - start, NULL);
+        if (numstr == NULL)
+            return NULL;
+        rval = PyObject_CallOneArg(custom_func, numstr);
+        Py_DECREF(numstr);
+        return rval;
+    }
+    if (!is_float && idx - start <= 18) {
+        /* Fits in a long long */
+        long long value = 0;
+        for (Py_ssize_t i = start + (buf[start] == '-'); i < idx; i++) {
+            value = value * 10 + (buf[i] - '0');
+        }
+        return PyLong_FromLongLong(buf[start] == '-' ? -value : value);
+    }
+    /* PyFloat_FromString() and PyLong_FromString() need a NUL-terminated
+       copy */
+    if (idx - start < (Py_ssize_t)sizeof(small)) {
+        memcpy(small, buf + start, idx - start);
+        small[idx - start] = '\0';
+        if (!is_float)
+            return PyLong_FromString(small, NULL, 10);
+        double d = PyOS_string_to_double(small, NULL, NULL);
+        if (d == -1.0 && PyErr_Occurred())
+            return NULL;
+        return PyFloat_FromDouble(d);
+    }
+    numstr = PyBytes_FromStringAndSize((const char *)buf + start, idx - start);
+    if (numstr == NULL)
+        return NULL;
+    if (is_float)
+        rval = PyFloat_FromString(numstr);
+    else
+        rval = PyLong_FromString(PyBytes_AS_STRING(numstr), NULL, 10);
+    Py_DECREF(numstr);
+    return rval;
+}
+
+static PyObject *
+scan_once_utf8(PyScannerObject *s, const Py_UCS1 *buf, Py_ssize_t len, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
+{
+    /* Read one JSON term (of any kind) from UTF-8 buf; see
+    scan_once_unicode() */
+    PyObject *res;
+
+    if (idx < 0) {
+        PyErr_SetString(PyExc_ValueError, "idx cannot be negative");
+        return NULL;
+    }
+    if (idx >= len) {
+        return NULL;
+    }
+
+    switch (buf[idx]) {
+        case '"':
+            /* string */
+            return scanstring_utf8(buf, len, idx + 1, s->strict, next_idx_ptr);
+        case '{':
+            /* object */
+            if (Py_EnterRecursiveCall(" while decoding a JSON object "
+                                      "from a bytes object"))
+                return NULL;
+            res = _parse_object_utf8(s, buf, len, idx + 1, next_idx_ptr);
+            Py_LeaveRecursiveCall();
+            return res;
+        case '[':
+            /* array */
+            if (Py_EnterRecursiveCall(" while decoding a JSON array "
+                                      "from a bytes object"))
+                return NULL;
+            res = _parse_array_utf8(s, buf, len, idx + 1, next_idx_ptr);
+            Py_LeaveRecursiveCall();
+            return res;
+        case 'n':
+            /* null */
+            if (len - idx >= 4 && memcmp(buf + idx, "null", 4) == 0) {
+                *next_idx_ptr = idx + 4;
+                Py_RETURN_NONE;
+            }
+            break;
+        case 't':
+            /* true */
+            if (len - idx >= 4 && memcmp(buf + idx, "true", 4) == 0) {
+                *next_idx_ptr = idx + 4;
+                Py_RETURN_TRUE;
+            }
+            break;
+        case 'f':
+            /* false */
+            if (len - idx >= 5 && memcmp(buf + idx, "false", 5) == 0) {
+                *next_idx_ptr = idx + 5;
+                Py_RETURN_FALSE;
+            }
+            break;
+        case 'N':
+            /* NaN */
+            if (len - idx >= 3 && memcmp(buf + idx, "NaN", 3) == 0) {
+                return _parse_constant(s, "NaN", idx, next_idx_ptr);
+            }
+            break;
+        case 'I':
+            /* Infinity */
+            if (len - idx >= 8 && memcmp(buf + idx, "Infinity", 8) == 0) {
+                return _parse_constant(s, "Infinity", idx, next_idx_ptr);
+            }
+            break;
+        case '-':
+            /* -Infinity */
+            if (len - idx >= 9 && memcmp(buf + idx, "-Infinity", 9) == 0) {
+                return _parse_constant(s, "-Infinity", idx, next_idx_ptr);
+            }
+            break;
+    }
+    /* Didn't find a string, object, array, or named constant. Look for a number. */
+    return _match_number_utf8(s, buf, len, idx, next_idx_ptr);
+}
+
 static PyObject *
 scanner_call(PyScannerObject *self, PyObject *args, PyObject *kwds)
 {
@@ -1148,9 +1773,23 @@ scanner_call(PyScannerObject *self, PyObject *args, PyObject *kwds)
     if (PyUnicode_Check(pystr)) {
         rval = scan_once_unicode(self, pystr, idx, &next_idx);
     }
+    else if (PyObject_CheckBuffer(pystr)) {
+        /* UTF-8 encoded JSON.  Return None if it must be decoded to str and
+           scanned again to find out what is wrong with it. */
+        Py_buffer view;
+        if (PyObject_GetBuffer(pystr, &view, PyBUF_SIMPLE) < 0)
+            return NULL;
+        rval = scan_once_utf8(self, view.buf, view.len, idx, &next_idx);
+        PyBuffer_Release(&view);
+        if (rval == NULL && !PyErr_Occurred()) {
+            PyDict_Clear(self->memo);
+            Py_RETURN_NONE;
+        }
+    }
     else {
         PyErr_Format(PyExc_TypeError,
-                 "first argument must be a string, not %.80s",
+                 "first argument must be a string or a bytes-like object, "
+                 "not %.80s",
                  Py_TYPE(pystr)->tp_name);
         return NULL;
     }
@@ -1163,9 +1802,12 @@ scanner_call(PyScannerObject *self, PyObject *args, PyObject *kwds)
 static PyObject *
 scanner_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
+    _Py_IDENTIFIER(cache_keys);
     PyScannerObject *s;
     PyObject *ctx;
     PyObject *strict;
+    PyObject *cache_keys;
+    int rc;
     static char *kwlist[] = {"context", NULL};
 
     if (!PyArg_ParseTupleAndKeywords(args, kwds, "O:make_scanner", kwlist, &ctx))
@@ -1203,6 +1845,22 @@ scanner_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     s->parse_constant = PyObject_GetAttrString(ctx, "parse_constant");
     if (s->parse_constant == NULL)
         goto bail;
+    /* cache_keys is optional */
+    if (_PyObject_LookupAttrId(ctx, &PyId_cache_keys, &cache_keys) < 0)
+        goto bail;
+    if (cache_keys != NULL) {
+        rc = PyObject_IsTrue(cache_keys);
+        Py_DECREF(cache_keys);
+        if (rc < 0)
+            goto bail;
+        if (rc) {
+            s->key_cache = PyMem_Calloc(KEY_CACHE_SIZE, sizeof(PyObject *));
+            if (s->key_cache == NULL) {
+                PyErr_NoMemory();
+                goto bail;
+            }
+        }
+    }
 
     return (PyObject *)s;
 
@@ -1286,24 +1944,63 @@ encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     return (PyObject *)s;
 }
 
+static int
+encoder_flush(EncoderOutput *out)
+{
+    /* Pass the output so far to out->write() and start a new chunk */
+    PyObject *chunk, *res;
+
+    chunk = _PyUnicodeWriter_Finish(&out->writer);
+    _PyUnicodeWriter_Init(&out->writer);
+    out->writer.overallocate = 1;
+    if (chunk == NULL)
+        return -1;
+    res = PyObject_CallOneArg(out->write, chunk);
+    Py_DECREF(chunk);
+    if (res == NULL)
+        return -1;
+    Py_DECREF(res);
+    return 0;
+}
+
+static inline int
+encoder_maybe_flush(EncoderOutput *out)
+{
+    if (out->write != NULL && out->writer.pos >= ENCODER_CHUNK_SIZE)
+        return encoder_flush(out);
+    return 0;
+}
+
 static PyObject *
 encoder_call(PyEncoderObject *self, PyObject *args, PyObject *kwds)
 {
     /* Python callable interface to encode_listencode_obj */
-    static char *kwlist[] = {"obj", "_current_indent_level", NULL};
-    PyObject *obj;
+    static char *kwlist[] = {"obj", "_current_indent_level", "write", NULL};
+    PyObject *obj, *write = Py_None, *result;
     Py_ssize_t indent_level;
-    _PyAccu acc;
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:_iterencode", kwlist,
-        &obj, &indent_level))
-        return NULL;
-    if (_PyAccu_Init(&acc))
+    EncoderOutput out;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "On|O:_iterencode", kwlist,
+        &obj, &indent_level, &write))
         return NULL;
-    if (encoder_listencode_obj(self, &acc, obj, indent_level)) {
-        _PyAccu_Destroy(&acc);
+    _PyUnicodeWriter_Init(&out.writer);
+    out.writer.overallocate = 1;
+    out.write = write == Py_None ? NULL : write;
+    if (encoder_listencode_obj(self, &out, obj, indent_level)) {
+        _PyUnicodeWriter_Dealloc(&out.writer);
         return NULL;
     }
-    return _PyAccu_FinishAsList(&acc);
+    if (out.write != NULL) {
+        if (out.writer.pos && encoder_flush(&out)) {
+            _PyUnicodeWriter_Dealloc(&out.writer);
+            return NULL;
+        }
+        _PyUnicodeWriter_Dealloc(&out.writer);
+        Py_RETURN_NONE;
+    }
+    result = _PyUnicodeWriter_Finish(&out.writer);
+    if (result == NULL)
+        return NULL;
+    return Py_BuildValue("(N)", result);
 }
 
 static PyObject *
@@ -1347,9 +2044,10 @@ encoder_encode_float(PyEncoderObject *s, PyObject *obj)
     double i = PyFloat_AS_DOUBLE(obj);
     if (!Py_IS_FINITE(i)) {
         if (!s->allow_nan) {
-            PyErr_SetString(
+            PyErr_Format(
                     PyExc_ValueError,
-                    "Out of range float values are not JSON compliant"
+                    "Out of range float values are not JSON compliant: %R",
+                    obj
                     );
             return NULL;
         }
@@ -1366,6 +2064,31 @@ encoder_encode_float(PyEncoderObject *s, PyObject *obj)
     return PyFloat_Type.tp_repr(obj);
 }
 
+static int
+encoder_write_float(PyEncoderObject *s, _PyUnicodeWriter *writer,
+                    PyObject *obj)
+{
+    /* Write the JSON representation of a PyFloat */
+    double d = PyFloat_AS_DOUBLE(obj);
+    char *buf;
+    int rv;
+
+    if (!Py_IS_FINITE(d)) {
+        PyObject *encoded = encoder_encode_float(s, obj);
+        if (encoded == NULL)
+            return -1;
+        rv = _PyUnicodeWriter_WriteStr(writer, encoded);
+        Py_DECREF(encoded);
+        return rv;
+    }
+    buf = PyOS_double_to_string(d, 'r', 0, Py_DTSF_ADD_DOT_0, NULL);
+    if (buf == NULL)
+        return -1;
+    rv = _PyUnicodeWriter_WriteASCIIString(writer, buf, strlen(buf));
+    PyMem_Free(buf);
+    return rv;
+}
+
 static PyObject *
 encoder_encode_string(PyEncoderObject *s, PyObject *obj)
 {
@@ -1387,58 +2110,82 @@ encoder_encode_string(PyEncoderObject *s, PyObject *obj)
 }
 
 static int
-_steal_accumulate(_PyAccu *acc, PyObject *stolen)
+encoder_write_string(PyEncoderObject *s, _PyUnicodeWriter *writer,
+                     PyObject *obj)
 {
-    /* Append stolen and then decrement its reference count */
-    int rval = _PyAccu_Accumulate(acc, stolen);
-    Py_DECREF(stolen);
-    return rval;
+    /* Write the JSON representation of a string.  Strings needing no
+       escapes, the common case, are copied between quotes directly. */
+    PyObject *encoded;
+    int rv;
+
+    if (s->fast_encode && PyUnicode_IS_READY(obj) &&
+        PyUnicode_KIND(obj) == PyUnicode_1BYTE_KIND)
+    {
+        const Py_UCS1 *p = PyUnicode_1BYTE_DATA(obj);
+        const Py_UCS1 *end = p + PyUnicode_GET_LENGTH(obj);
+
+        if (s->fast_encode == (PyCFunction)py_encode_basestring_ascii) {
+            while (p < end && S_CHAR(*p))
+                p++;
+        }
+        else {
+            while (p < end && *p > 0x1f && *p != '\\' && *p != '"')
+                p++;
+        }
+        if (p == end) {
+            if (_PyUnicodeWriter_WriteChar(writer, '"') < 0 ||
+                _PyUnicodeWriter_WriteStr(writer, obj) < 0 ||
+                _PyUnicodeWriter_WriteChar(writer, '"') < 0)
+                return -1;
+            return 0;
+        }
+    }
+    encoded = encoder_encode_string(s, obj);
+    if (encoded == NULL)
+        return -1;
+    rv = _PyUnicodeWriter_WriteStr(writer, encoded);
+    Py_DECREF(encoded);
+    return rv;
 }
 
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_obj(PyEncoderObject *s, EncoderOutput *out,
                        PyObject *obj, Py_ssize_t indent_level)
 {
     /* Encode Python object obj to a JSON term */
+    _PyUnicodeWriter *writer = &out->writer;
     PyObject *newobj;
     int rv;
 
-    if (obj == Py_None || obj == Py_True || obj == Py_False) {
-        PyObject *cstr = _encoded_const(obj);
-        if (cstr == NULL)
-            return -1;
-        return _steal_accumulate(acc, cstr);
+    if (obj == Py_None) {
+        return _PyUnicodeWriter_WriteASCIIString(writer, "null", 4);
     }
-    else if (PyUnicode_Check(obj))
-    {
-        PyObject *encoded = encoder_encode_string(s, obj);
-        if (encoded == NULL)
-            return -1;
-        return _steal_accumulate(acc, encoded);
+    else if (obj == Py_True) {
+        return _PyUnicodeWriter_WriteASCIIString(writer, "true", 4);
+    }
+    else if (obj == Py_False) {
+        return _PyUnicodeWriter_WriteASCIIString(writer, "false", 5);
+    }
+    else if (PyUnicode_Check(obj)) {
+        return encoder_write_string(s, writer, obj);
     }
     else if (PyLong_Check(obj)) {
-        PyObject *encoded = PyLong_Type.tp_repr(obj);
-        if (encoded == NULL)
-            return -1;
-        return _steal_accumulate(acc, encoded);
+        return _PyLong_FormatWriter(writer, obj, 10, 0);
     }
     else if (PyFloat_Check(obj)) {
-        PyObject *encoded = encoder_encode_float(s, obj);
-        if (encoded == NULL)
-            return -1;
-        return _steal_accumulate(acc, encoded);
+        return encoder_write_float(s, writer, obj);
     }
     else if (PyList_Check(obj) || PyTuple_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_list(s, acc, obj, indent_level);
+        rv = encoder_listencode_list(s, out, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
     else if (PyDict_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_dict(s, acc, obj, indent_level);
+        rv = encoder_listencode_dict(s, out, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
@@ -1472,7 +2219,7 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
             Py_XDECREF(ident);
             return -1;
         }
-        rv = encoder_listencode_obj(s, acc, newobj, indent_level);
+        rv = encoder_listencode_obj(s, out, newobj, indent_level);
         Py_LeaveRecursiveCall();
 
         Py_DECREF(newobj);
@@ -1492,16 +2239,11 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
 }
 
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_dict(PyEncoderObject *s, EncoderOutput *out,
                         PyObject *dct, Py_ssize_t indent_level)
 {
     /* Encode Python dict dct a JSON term */
-    _Py_static_string(PyId_open_dict, "{");
-    _Py_static_string(PyId_close_dict, "}");
-    _Py_static_string(PyId_empty_dict, "{}");
-    PyObject *open_dict = _PyUnicode_FromId(&PyId_open_dict);    // borrowed ref
-    PyObject *close_dict = _PyUnicode_FromId(&PyId_close_dict);  // borrowed ref
-    PyObject *empty_dict = _PyUnicode_FromId(&PyId_empty_dict);  // borrowed ref
+    _PyUnicodeWriter *writer = &out->writer;
     PyObject *kstr = NULL;
     PyObject *ident = NULL;
     PyObject *it = NULL;
@@ -1509,11 +2251,8 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
     PyObject *item = NULL;
     Py_ssize_t idx;
 
-    if (open_dict == NULL || close_dict == NULL || empty_dict == NULL) {
-        return -1;
-    }
     if (PyDict_GET_SIZE(dct) == 0)  /* Fast path */
-        return _PyAccu_Accumulate(acc, empty_dict);
+        return _PyUnicodeWriter_WriteASCIIString(writer, "{}", 2);
 
     if (s->markers != Py_None) {
         int has_key;
@@ -1531,7 +2270,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_dict))
+    if (_PyUnicodeWriter_WriteChar(writer, '{'))
         goto bail;
 
     if (s->indent != Py_None) {
@@ -1557,7 +2296,8 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         goto bail;
     idx = 0;
     while ((item = PyIter_Next(it)) != NULL) {
-        PyObject *encoded, *key, *value;
+        PyObject *key, *value;
+        int rv;
         if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
             PyErr_SetString(PyExc_ValueError, "items must return 2-tuples");
             goto bail;
@@ -1597,24 +2337,21 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
 
         if (idx) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (_PyUnicodeWriter_WriteStr(writer, s->item_separator))
                 goto bail;
         }
 
-        encoded = encoder_encode_string(s, kstr);
+        rv = encoder_write_string(s, writer, kstr);
         Py_CLEAR(kstr);
-        if (encoded == NULL)
+        if (rv)
             goto bail;
-        if (_PyAccu_Accumulate(acc, encoded)) {
-            Py_DECREF(encoded);
-            goto bail;
-        }
-        Py_DECREF(encoded);
-        if (_PyAccu_Accumulate(acc, s->key_separator))
+        if (_PyUnicodeWriter_WriteStr(writer, s->key_separator))
             goto bail;
 
         value = PyTuple_GET_ITEM(item, 1);
-        if (encoder_listencode_obj(s, acc, value, indent_level))
+        if (encoder_listencode_obj(s, out, value, indent_level))
+            goto bail;
+        if (encoder_maybe_flush(out))
             goto bail;
         idx += 1;
         Py_DECREF(item);
@@ -1634,7 +2371,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_dict))
+    if (_PyUnicodeWriter_WriteChar(writer, '}'))
         goto bail;
     return 0;
 
@@ -1648,30 +2385,22 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
 
 
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_list(PyEncoderObject *s, EncoderOutput *out,
                         PyObject *seq, Py_ssize_t indent_level)
 {
     /* Encode Python list seq to a JSON term */
-    _Py_static_string(PyId_open_array, "[");
-    _Py_static_string(PyId_close_array, "]");
-    _Py_static_string(PyId_empty_array, "[]");
-    PyObject *open_array = _PyUnicode_FromId(&PyId_open_array);   // borrowed ref
-    PyObject *close_array = _PyUnicode_FromId(&PyId_close_array); // borrowed ref
-    PyObject *empty_array = _PyUnicode_FromId(&PyId_empty_array); // borrowed ref
+    _PyUnicodeWriter *writer = &out->writer;
     PyObject *ident = NULL;
     PyObject *s_fast = NULL;
     Py_ssize_t i;
 
-    if (open_array == NULL || close_array == NULL || empty_array == NULL) {
-        return -1;
-    }
     ident = NULL;
     s_fast = PySequence_Fast(seq, "_iterencode_list needs a sequence");
     if (s_fast == NULL)
         return -1;
     if (PySequence_Fast_GET_SIZE(s_fast) == 0) {
         Py_DECREF(s_fast);
-        return _PyAccu_Accumulate(acc, empty_array);
+        return _PyUnicodeWriter_WriteASCIIString(writer, "[]", 2);
     }
 
     if (s->markers != Py_None) {
@@ -1690,7 +2419,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_array))
+    if (_PyUnicodeWriter_WriteChar(writer, '['))
         goto bail;
     if (s->indent != Py_None) {
         /* TODO: DOES NOT RUN */
@@ -1704,10 +2433,12 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
     for (i = 0; i < PySequence_Fast_GET_SIZE(s_fast); i++) {
         PyObject *obj = PySequence_Fast_GET_ITEM(s_fast, i);
         if (i) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (_PyUnicodeWriter_WriteStr(writer, s->item_separator))
                 goto bail;
         }
-        if (encoder_listencode_obj(s, acc, obj, indent_level))
+        if (encoder_listencode_obj(s, out, obj, indent_level))
+            goto bail;
+        if (encoder_maybe_flush(out))
             goto bail;
     }
     if (ident != NULL) {
@@ -1722,7 +2453,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_array))
+    if (_PyUnicodeWriter_WriteChar(writer, ']'))
         goto bail;
     Py_DECREF(s_fast);
     return 0;
@@ -1770,7 +2501,11 @@ encoder_clear(PyEncoderObject *self)
     return 0;
 }
 
-PyDoc_STRVAR(encoder_doc, "_iterencode(obj, _current_indent_level) -> iterable");
+PyDoc_STRVAR(encoder_doc,
+"_iterencode(obj, _current_indent_level, write=None) -> iterable\n"
+"\n"
+"Return a 1-tuple holding the JSON representation of obj, or pass it to\n"
+"write() in chunks and return None if write is given.");
 
 static PyType_Slot PyEncoderType_slots[] = {
     {Py_tp_doc, (void *)encoder_doc},
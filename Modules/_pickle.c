@@ -132,7 +132,12 @@ enum {
 
     FRAME_SIZE_MIN = 4,
     FRAME_SIZE_TARGET = 64 * 1024,
-    FRAME_HEADER_SIZE = 9
+    FRAME_HEADER_SIZE = 9,
+
+    /* Size of the buffer for runs of atoms in containers, and the longest
+       encoding of an atom, see save_buffered(). */
+    ATOM_BUFSIZE = 256,
+    ATOM_MAXSIZE = 9
 };
 
 /*************************************************************************/
@@ -603,16 +608,15 @@ Pdata_poplist(Pdata *self, Py_ssize_t start)
     return list;
 }
 
-typedef struct {
-    PyObject *me_key;
-    Py_ssize_t me_value;
-} PyMemoEntry;
-
+/* The keys and values of the memo table are stored in separate arrays, so
+   that probing for a key, which usually fails, scans densely packed keys. */
 typedef struct {
     size_t mt_mask;
     size_t mt_used;
     size_t mt_allocated;
-    PyMemoEntry *mt_table;
+    int mt_shift;               /* 4 + log2(mt_allocated), see MT_HASH */
+    PyObject **mt_keys;         /* NULL marks an empty slot */
+    Py_ssize_t *mt_values;
 } PyMemoTable;
 
 typedef struct PicklerObject {
@@ -650,8 +654,12 @@ typedef struct PicklerObject {
     int fast_nesting;
     int fix_imports;            /* Indicate whether Pickler should fix
                                    the name of globals for Python 2.x. */
+    int memoize_atomic;         /* Memoize str and bytes objects */
     PyObject *fast_memo;
     PyObject *buffer_callback;  /* Callback for out-of-band buffers, or NULL */
+    Py_ssize_t atom_len;        /* Number of bytes in atom_buf. */
+    char atom_buf[ATOM_BUFSIZE]; /* Encodings of the atoms saved by
+                                    save_buffered() and not written out yet. */
 } PicklerObject;
 
 typedef struct UnpicklerObject {
@@ -721,8 +729,51 @@ static PyTypeObject Unpickler_Type;
  difference. */
 
 #define MT_MINSIZE 8
-#define PERTURB_SHIFT 5
 
+/* Objects close in memory, such as the items of a container created in a
+   loop, hash to nearby slots, so that the table is accessed mostly in
+   order.  The address bits above those selecting the slot are scrambled
+   by multiplying them by 2**N / phi and added, so that objects at the same
+   offset from distant addresses, such as large aligned blocks, spread
+   over the table. */
+#if SIZEOF_SIZE_T == 8
+#  define MT_HASH_MULTIPLIER 0x9E3779B97F4A7C15ULL
+#else
+#  define MT_HASH_MULTIPLIER 0x9E3779B9UL
+#endif
+#define MT_HASH(self, key) \
+    ((((size_t)(key) >> 4) + \
+      ((size_t)(key) >> (self)->mt_shift) * MT_HASH_MULTIPLIER) & \
+     (self)->mt_mask)
+
+/* Allocate the arrays of an empty table of size entries, a power of 2. */
+static int
+_PyMemoTable_Alloc(PyMemoTable *self, size_t size)
+{
+    int shift = 4;
+    PyObject **keys;
+
+    assert(size >= MT_MINSIZE && (size & (size - 1)) == 0);
+    if (size > PY_SSIZE_T_MAX / (sizeof(PyObject *) + sizeof(Py_ssize_t))) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    /* The values follow the keys in a single block. */
+    keys = PyMem_Calloc(size, sizeof(PyObject *) + sizeof(Py_ssize_t));
+    if (keys == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (size_t n = size; n > 1; n >>= 1) {
+        shift++;
+    }
+    self->mt_keys = keys;
+    self->mt_values = (Py_ssize_t *)(keys + size);
+    self->mt_allocated = size;
+    self->mt_mask = size - 1;
+    self->mt_shift = shift;
+    return 0;
+}
 
 static PyMemoTable *
 PyMemoTable_New(void)
@@ -734,15 +785,10 @@ PyMemoTable_New(void)
     }
 
     memo->mt_used = 0;
-    memo->mt_allocated = MT_MINSIZE;
-    memo->mt_mask = MT_MINSIZE - 1;
-    memo->mt_table = PyMem_Malloc(MT_MINSIZE * sizeof(PyMemoEntry));
-    if (memo->mt_table == NULL) {
+    if (_PyMemoTable_Alloc(memo, MT_MINSIZE) < 0) {
         PyMem_Free(memo);
-        PyErr_NoMemory();
         return NULL;
     }
-    memset(memo->mt_table, 0, MT_MINSIZE * sizeof(PyMemoEntry));
 
     return memo;
 }
@@ -750,27 +796,22 @@ PyMemoTable_New(void)
 static PyMemoTable *
 PyMemoTable_Copy(PyMemoTable *self)
 {
-    PyMemoTable *new = PyMemoTable_New();
-    if (new == NULL)
+    PyMemoTable *new = PyMem_Malloc(sizeof(PyMemoTable));
+    if (new == NULL) {
+        PyErr_NoMemory();
         return NULL;
-
-    new->mt_used = self->mt_used;
-    new->mt_allocated = self->mt_allocated;
-    new->mt_mask = self->mt_mask;
-    /* The table we get from _New() is probably smaller than we wanted.
-       Free it and allocate one that's the right size. */
-    PyMem_Free(new->mt_table);
-    new->mt_table = PyMem_NEW(PyMemoEntry, self->mt_allocated);
-    if (new->mt_table == NULL) {
+    }
+    if (_PyMemoTable_Alloc(new, self->mt_allocated) < 0) {
         PyMem_Free(new);
-        PyErr_NoMemory();
         return NULL;
     }
+
+    new->mt_used = self->mt_used;
     for (size_t i = 0; i < self->mt_allocated; i++) {
-        Py_XINCREF(self->mt_table[i].me_key);
+        Py_XINCREF(self->mt_keys[i]);
     }
-    memcpy(new->mt_table, self->mt_table,
-           sizeof(PyMemoEntry) * self->mt_allocated);
+    memcpy(new->mt_keys, self->mt_keys,
+           (sizeof(PyObject *) + sizeof(Py_ssize_t)) * self->mt_allocated);
 
     return new;
 }
@@ -787,10 +828,10 @@ PyMemoTable_Clear(PyMemoTable *self)
     Py_ssize_t i = self->mt_allocated;
 
     while (--i >= 0) {
-        Py_XDECREF(self->mt_table[i].me_key);
+        Py_XDECREF(self->mt_keys[i]);
     }
     self->mt_used = 0;
-    memset(self->mt_table, 0, self->mt_allocated * sizeof(PyMemoEntry));
+    memset(self->mt_keys, 0, self->mt_allocated * sizeof(PyObject *));
     return 0;
 }
 
@@ -801,44 +842,34 @@ PyMemoTable_Del(PyMemoTable *self)
         return;
     PyMemoTable_Clear(self);
 
-    PyMem_Free(self->mt_table);
+    PyMem_Free(self->mt_keys);
     PyMem_Free(self);
 }
 
 /* Since entries cannot be deleted from this hashtable, _PyMemoTable_Lookup()
-   can be considerably simpler than dictobject.c's lookdict(). */
-static PyMemoEntry *
+   can use linear probing, which stays within the same cache lines, and
+   return the slot of either the key or the empty slot where it belongs. */
+static size_t
 _PyMemoTable_Lookup(PyMemoTable *self, PyObject *key)
 {
-    size_t i;
-    size_t perturb;
     size_t mask = self->mt_mask;
-    PyMemoEntry *table = self->mt_table;
-    PyMemoEntry *entry;
-    Py_hash_t hash = (Py_hash_t)key >> 3;
-
-    i = hash & mask;
-    entry = &table[i];
-    if (entry->me_key == NULL || entry->me_key == key)
-        return entry;
+    PyObject **keys = self->mt_keys;
+    size_t i = MT_HASH(self, key);
 
-    for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
-        i = (i << 2) + i + perturb + 1;
-        entry = &table[i & mask];
-        if (entry->me_key == NULL || entry->me_key == key)
-            return entry;
+    while (keys[i] != NULL && keys[i] != key) {
+        i = (i + 1) & mask;
     }
-    Py_UNREACHABLE();
+    return i;
 }
 
 /* Returns -1 on failure, 0 on success. */
 static int
 _PyMemoTable_ResizeTable(PyMemoTable *self, size_t min_size)
 {
-    PyMemoEntry *oldtable = NULL;
-    PyMemoEntry *oldentry, *newentry;
+    PyObject **oldkeys = self->mt_keys;
+    Py_ssize_t *oldvalues = self->mt_values;
+    size_t oldsize = self->mt_allocated;
     size_t new_size = MT_MINSIZE;
-    size_t to_process;
 
     assert(min_size > 0);
 
@@ -851,66 +882,67 @@ _PyMemoTable_ResizeTable(PyMemoTable *self, size_t min_size)
     while (new_size < min_size) {
         new_size <<= 1;
     }
-    /* new_size needs to be a power of two. */
-    assert((new_size & (new_size - 1)) == 0);
 
     /* Allocate new table. */
-    oldtable = self->mt_table;
-    self->mt_table = PyMem_NEW(PyMemoEntry, new_size);
-    if (self->mt_table == NULL) {
-        self->mt_table = oldtable;
-        PyErr_NoMemory();
+    if (_PyMemoTable_Alloc(self, new_size) < 0) {
         return -1;
     }
-    self->mt_allocated = new_size;
-    self->mt_mask = new_size - 1;
-    memset(self->mt_table, 0, sizeof(PyMemoEntry) * new_size);
 
     /* Copy entries from the old table. */
-    to_process = self->mt_used;
-    for (oldentry = oldtable; to_process > 0; oldentry++) {
-        if (oldentry->me_key != NULL) {
-            to_process--;
-            /* newentry is a pointer to a chunk of the new
-               mt_table, so we're setting the key:value pair
-               in-place. */
-            newentry = _PyMemoTable_Lookup(self, oldentry->me_key);
-            newentry->me_key = oldentry->me_key;
-            newentry->me_value = oldentry->me_value;
+    for (size_t i = 0; i < oldsize; i++) {
+        if (oldkeys[i] != NULL) {
+            size_t j = _PyMemoTable_Lookup(self, oldkeys[i]);
+            self->mt_keys[j] = oldkeys[i];
+            self->mt_values[j] = oldvalues[i];
         }
     }
 
     /* Deallocate the old table. */
-    PyMem_Free(oldtable);
+    PyMem_Free(oldkeys);
     return 0;
 }
 
+/* Make room for n entries in total without resizing.
+   Returns -1 on failure, 0 on success. */
+static int
+PyMemoTable_Reserve(PyMemoTable *self, size_t n)
+{
+    if (n > PY_SSIZE_T_MAX / 3) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (n * 3 < self->mt_allocated * 2) {
+        return 0;
+    }
+    return _PyMemoTable_ResizeTable(self, n * 3 / 2 + 1);
+}
+
 /* Returns NULL on failure, a pointer to the value otherwise. */
 static Py_ssize_t *
 PyMemoTable_Get(PyMemoTable *self, PyObject *key)
 {
-    PyMemoEntry *entry = _PyMemoTable_Lookup(self, key);
-    if (entry->me_key == NULL)
+    size_t i = _PyMemoTable_Lookup(self, key);
+    if (self->mt_keys[i] == NULL)
         return NULL;
-    return &entry->me_value;
+    return &self->mt_values[i];
 }
 
 /* Returns -1 on failure, 0 on success. */
 static int
 PyMemoTable_Set(PyMemoTable *self, PyObject *key, Py_ssize_t value)
 {
-    PyMemoEntry *entry;
+    size_t i;
 
     assert(key != NULL);
 
-    entry = _PyMemoTable_Lookup(self, key);
-    if (entry->me_key != NULL) {
-        entry->me_value = value;
+    i = _PyMemoTable_Lookup(self, key);
+    if (self->mt_keys[i] != NULL) {
+        self->mt_values[i] = value;
         return 0;
     }
     Py_INCREF(key);
-    entry->me_key = key;
-    entry->me_value = value;
+    self->mt_keys[i] = key;
+    self->mt_values[i] = value;
     self->mt_used++;
 
     /* If we added a key, we can safely resize. Otherwise just return!
@@ -932,7 +964,8 @@ PyMemoTable_Set(PyMemoTable *self, PyObject *key, Py_ssize_t value)
 }
 
 #undef MT_MINSIZE
-#undef PERTURB_SHIFT
+#undef MT_HASH_MULTIPLIER
+#undef MT_HASH
 
 /*************************************************************************/
 
@@ -946,6 +979,7 @@ _Pickler_ClearBuffer(PicklerObject *self)
         return -1;
     self->output_len = 0;
     self->frame_start = -1;
+    self->atom_len = 0;
     return 0;
 }
 
@@ -1122,9 +1156,11 @@ _Pickler_New(void)
     self->fast = 0;
     self->fast_nesting = 0;
     self->fix_imports = 0;
+    self->memoize_atomic = 1;
     self->fast_memo = NULL;
     self->max_output_len = WRITE_BUF_SIZE;
     self->output_len = 0;
+    self->atom_len = 0;
     self->reducer_override = NULL;
 
     self->memo = PyMemoTable_New();
@@ -2390,7 +2426,7 @@ _save_bytes_data(PicklerObject *self, PyObject *obj, const char *data,
         return -1;
     }
 
-    if (memo_put(self, obj) < 0) {
+    if (self->memoize_atomic && memo_put(self, obj) < 0) {
         return -1;
     }
 
@@ -2735,12 +2771,104 @@ save_unicode(PicklerObject *self, PyObject *obj)
         if (_Pickler_Write(self, "\n", 1) < 0)
             return -1;
     }
-    if (memo_put(self, obj) < 0)
+    if (self->memoize_atomic && memo_put(self, obj) < 0)
         return -1;
 
     return 0;
 }
 
+/* Encode obj into out, as save() would in binary mode, if it is None, a
+   bool, an int that fits in 4 bytes or a float.  Returns the size of the
+   encoding, at most ATOM_MAXSIZE, 0 if obj is not such an object, or -1 on
+   failure. */
+static Py_ssize_t
+encode_atom(PicklerObject *self, PyObject *obj, char *out)
+{
+    PyTypeObject *type = Py_TYPE(obj);
+
+    assert(self->bin);
+    if (type == &PyFloat_Type) {
+        out[0] = BINFLOAT;
+        if (_PyFloat_Pack8(PyFloat_AS_DOUBLE(obj),
+                           (unsigned char *)out + 1, 0) < 0)
+            return -1;
+        return 9;
+    }
+    else if (type == &PyLong_Type) {
+        int overflow;
+        long val = PyLong_AsLongAndOverflow(obj, &overflow);
+
+        if (overflow || (sizeof(long) > 4 &&
+                         (val > 0x7fffffffL || val < (-0x7fffffffL - 1))))
+            return 0;
+        out[1] = (unsigned char)(val & 0xff);
+        out[2] = (unsigned char)((val >> 8) & 0xff);
+        out[3] = (unsigned char)((val >> 16) & 0xff);
+        out[4] = (unsigned char)((val >> 24) & 0xff);
+        if ((out[4] != 0) || (out[3] != 0)) {
+            out[0] = BININT;
+            return 5;
+        }
+        else if (out[2] != 0) {
+            out[0] = BININT2;
+            return 3;
+        }
+        out[0] = BININT1;
+        return 2;
+    }
+    else if (obj == Py_None) {
+        out[0] = NONE;
+        return 1;
+    }
+    else if ((obj == Py_True || obj == Py_False) && self->proto >= 2) {
+        out[0] = (obj == Py_True) ? NEWTRUE : NEWFALSE;
+        return 1;
+    }
+    return 0;
+}
+
+/* Write out the atoms buffered by save_buffered(). */
+static int
+flush_atoms(PicklerObject *self)
+{
+    Py_ssize_t len = self->atom_len;
+
+    if (len == 0)
+        return 0;
+    self->atom_len = 0;
+    if (_Pickler_Write(self, self->atom_buf, len) < 0)
+        return -1;
+    return _Pickler_OpcodeBoundary(self);
+}
+
+/* Save obj like save(), except that if it is an atom (see encode_atom()),
+   append its encoding to self->atom_buf, which is written out when full or
+   before saving another object.  This saves the items of containers of
+   numbers in a tight loop.  The buffer is shared by all the containers
+   being saved, but it is always empty when save() is called, so that a
+   nested container starts with an empty buffer and leaves it empty.  The
+   caller must call flush_atoms() when done. */
+static int
+save_buffered(PicklerObject *self, PyObject *obj)
+{
+    /* Persistent ids must be looked up for atoms too. */
+    if (self->bin && self->pers_func == NULL) {
+        Py_ssize_t size = encode_atom(self, obj,
+                                      self->atom_buf + self->atom_len);
+        if (size < 0)
+            return -1;
+        if (size > 0) {
+            self->atom_len += size;
+            if (self->atom_len > ATOM_BUFSIZE - ATOM_MAXSIZE)
+                return flush_atoms(self);
+            return 0;
+        }
+    }
+    if (flush_atoms(self) < 0)
+        return -1;
+    return save(self, obj, 0);
+}
+
 /* A helper for save_tuple.  Push the len elements in tuple t on the stack. */
 static int
 store_tuple_elements(PicklerObject *self, PyObject *t, Py_ssize_t len)
@@ -2754,11 +2882,11 @@ store_tuple_elements(PicklerObject *self, PyObject *t, Py_ssize_t len)
 
         if (element == NULL)
             return -1;
-        if (save(self, element, 0) < 0)
+        if (save_buffered(self, element) < 0)
             return -1;
     }
 
-    return 0;
+    return flush_atoms(self);
 }
 
 /* Tuples are ubiquitous in the pickle protocols, so many techniques are
@@ -3020,12 +3148,14 @@ batch_list_exact(PicklerObject *self, PyObject *obj)
             return -1;
         while (total < PyList_GET_SIZE(obj)) {
             item = PyList_GET_ITEM(obj, total);
-            if (save(self, item, 0) < 0)
+            if (save_buffered(self, item) < 0)
                 return -1;
             total++;
             if (++this_batch == BATCHSIZE)
                 break;
         }
+        if (flush_atoms(self) < 0)
+            return -1;
         if (_Pickler_Write(self, &appends_op, 1) < 0)
             return -1;
 
@@ -3273,13 +3403,15 @@ batch_dict_exact(PicklerObject *self, PyObject *obj)
         if (_Pickler_Write(self, &mark_op, 1) < 0)
             return -1;
         while (PyDict_Next(obj, &ppos, &key, &value)) {
-            if (save(self, key, 0) < 0)
+            if (save_buffered(self, key) < 0)
                 return -1;
-            if (save(self, value, 0) < 0)
+            if (save_buffered(self, value) < 0)
                 return -1;
             if (++i == BATCHSIZE)
                 break;
         }
+        if (flush_atoms(self) < 0)
+            return -1;
         if (_Pickler_Write(self, &setitems_op, 1) < 0)
             return -1;
         if (PyDict_GET_SIZE(obj) != dict_size) {
@@ -4296,6 +4428,17 @@ save(PicklerObject *self, PyObject *obj, int pers_save)
         return save_float(self, obj);
     }
 
+    /* Without memoize_atomic, str and bytes (unless saved with the copy
+       protocol) are not memoized either. */
+    if (!self->memoize_atomic) {
+        if (type == &PyUnicode_Type) {
+            return save_unicode(self, obj);
+        }
+        else if (type == &PyBytes_Type && self->proto >= 3) {
+            return save_bytes(self, obj);
+        }
+    }
+
     /* Check the memo to see if it has the object. If so, generate
        a GET (or BINGET) opcode, instead of pickling the object
        once again. */
@@ -4608,7 +4751,8 @@ _pickle_Pickler___sizeof___impl(PicklerObject *self)
     res = _PyObject_SIZE(Py_TYPE(self));
     if (self->memo != NULL) {
         res += sizeof(PyMemoTable);
-        res += self->memo->mt_allocated * sizeof(PyMemoEntry);
+        res += self->memo->mt_allocated * (sizeof(PyObject *) +
+                                           sizeof(Py_ssize_t));
     }
     if (self->output_buffer != NULL) {
         s = _PySys_GetSizeOf(self->output_buffer);
@@ -4684,6 +4828,7 @@ _pickle.Pickler.__init__
   protocol: object = None
   fix_imports: bool = True
   buffer_callback: object = None
+  memoize_atomic: bool = True
 
 This takes a binary file for writing a pickle data stream.
 
@@ -4716,13 +4861,17 @@ buffer is serialized in-band, i.e. inside the pickle stream.
 It is an error if *buffer_callback* is not None and *protocol*
 is None or smaller than 5.
 
+If *memoize_atomic* is false, str and bytes objects are not memoized:
+every occurrence is pickled in full and unpickled as a distinct object.
+This makes pickling faster when such objects are rarely repeated.
+
 [clinic start generated code]*/
 
 static int
 _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
                               PyObject *protocol, int fix_imports,
-                              PyObject *buffer_callback)
-/*[clinic end generated code: output=0abedc50590d259b input=a7c969699bf5dad3]*/
+                              PyObject *buffer_callback, int memoize_atomic)
+/*[clinic end generated code: output=90b98cbb6f560df4 input=e985411c08c9239b]*/
 {
     _Py_IDENTIFIER(persistent_id);
     _Py_IDENTIFIER(dispatch_table);
@@ -4739,6 +4888,7 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
 
     if (_Pickler_SetBufferCallback(self, buffer_callback) < 0)
         return -1;
+    self->memoize_atomic = memoize_atomic;
 
     /* memo and output_buffer may have already been created in _Pickler_New */
     if (self->memo == NULL) {
@@ -4816,13 +4966,13 @@ _pickle_PicklerMemoProxy_copy_impl(PicklerMemoProxyObject *self)
 
     memo = self->pickler->memo;
     for (size_t i = 0; i < memo->mt_allocated; ++i) {
-        PyMemoEntry entry = memo->mt_table[i];
-        if (entry.me_key != NULL) {
+        PyObject *memo_obj = memo->mt_keys[i];
+        if (memo_obj != NULL) {
             int status;
             PyObject *key, *value;
 
-            key = PyLong_FromVoidPtr(entry.me_key);
-            value = Py_BuildValue("nO", entry.me_value, entry.me_key);
+            key = PyLong_FromVoidPtr(memo_obj);
+            value = Py_BuildValue("nO", memo->mt_values[i], memo_obj);
 
             if (key == NULL || value == NULL) {
                 Py_XDECREF(key);
@@ -4985,6 +5135,8 @@ Pickler_set_memo(PicklerObject *self, PyObject *obj, void *Py_UNUSED(ignored))
         new_memo = PyMemoTable_New();
         if (new_memo == NULL)
             return -1;
+        if (PyMemoTable_Reserve(new_memo, PyDict_GET_SIZE(obj)) < 0)
+            goto error;
 
         while (PyDict_Next(obj, &i, &key, &value)) {
             Py_ssize_t memo_id;
@@ -5261,6 +5413,70 @@ calc_binint(char *bytes, int nbytes)
     return x;
 }
 
+/* Push the values of the BININT, BININT1, BININT2 and BINFLOAT opcodes
+   following in the input buffer, up to another opcode or the end of the
+   buffer, as their loaders would.  This loads the items of containers of
+   numbers in a tight loop. */
+static int
+load_number_run(UnpicklerObject *self)
+{
+    const unsigned char *s = (const unsigned char *)self->input_buffer;
+    Py_ssize_t i = self->next_read_idx;
+    Py_ssize_t end = self->input_len;
+    int status = 0;
+
+    while (i < end) {
+        PyObject *value;
+        double x;
+
+        switch ((enum opcode)s[i]) {
+        case BININT1:
+            if (end - i < 2)
+                goto done;
+            value = PyLong_FromLong(s[i + 1]);
+            i += 2;
+            break;
+        case BININT2:
+            if (end - i < 3)
+                goto done;
+            value = PyLong_FromLong(s[i + 1] | ((long)s[i + 2] << 8));
+            i += 3;
+            break;
+        case BININT:
+            if (end - i < 5)
+                goto done;
+            value = PyLong_FromLong(calc_binint((char *)s + i + 1, 4));
+            i += 5;
+            break;
+        case BINFLOAT:
+            if (end - i < 9)
+                goto done;
+            x = _PyFloat_Unpack8(s + i + 1, 0);
+            if (x == -1.0 && PyErr_Occurred()) {
+                status = -1;
+                goto done;
+            }
+            value = PyFloat_FromDouble(x);
+            i += 9;
+            break;
+        default:
+            goto done;
+        }
+        if (value == NULL) {
+            status = -1;
+            goto done;
+        }
+        if (Pdata_push(self->stack, value) < 0) {
+            Py_DECREF(value);
+            status = -1;
+            goto done;
+        }
+    }
+  done:
+    self->next_read_idx = i;
+    return status;
+}
+
 static int
 load_binintx(UnpicklerObject *self, char *s, int size)
 {
@@ -5273,7 +5489,7 @@ load_binintx(UnpicklerObject *self, char *s, int size)
         return -1;
 
     PDATA_PUSH(self->stack, value, -1);
-    return 0;
+    return load_number_run(self);
 }
 
 static int
@@ -5421,7 +5637,7 @@ load_binfloat(UnpicklerObject *self)
         return -1;
 
     PDATA_PUSH(self->stack, value, -1);
-    return 0;
+    return load_number_run(self);
 }
 
 static int
@@ -7642,6 +7858,7 @@ _pickle.dump
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  memoize_atomic: bool = True
 
 Write a pickled representation of obj to the open file object file.
 
@@ -7670,13 +7887,16 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+If *memoize_atomic* is false, str and bytes objects are not memoized:
+every occurrence is pickled in full and unpickled as a distinct object.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
                   PyObject *protocol, int fix_imports,
-                  PyObject *buffer_callback)
-/*[clinic end generated code: output=706186dba996490c input=5ed6653da99cd97c]*/
+                  PyObject *buffer_callback, int memoize_atomic)
+/*[clinic end generated code: output=527b5c3d08e0272d input=f32dfb5123f27d6b]*/
 {
     PicklerObject *pickler = _Pickler_New();
 
@@ -7691,6 +7911,7 @@ _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
 
     if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
         goto error;
+    pickler->memoize_atomic = memoize_atomic;
 
     if (dump(pickler, obj) < 0)
         goto error;
@@ -7715,6 +7936,7 @@ _pickle.dumps
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  memoize_atomic: bool = True
 
 Return the pickled representation of the object as a bytes object.
 
@@ -7735,12 +7957,16 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+If *memoize_atomic* is false, str and bytes objects are not memoized:
+every occurrence is pickled in full and unpickled as a distinct object.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
-                   int fix_imports, PyObject *buffer_callback)
-/*[clinic end generated code: output=fbab0093a5580fdf input=e543272436c6f987]*/
+                   int fix_imports, PyObject *buffer_callback,
+                   int memoize_atomic)
+/*[clinic end generated code: output=167f41d90f77d75a input=594fee3971ca2e52]*/
 {
     PyObject *result;
     PicklerObject *pickler = _Pickler_New();
@@ -7753,6 +7979,7 @@ _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
 
     if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
         goto error;
+    pickler->memoize_atomic = memoize_atomic;
 
     if (dump(pickler, obj) < 0)
         goto error;
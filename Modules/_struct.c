@@ -6,7 +6,9 @@
 #define PY_SSIZE_T_CLEAN
 
 #include "Python.h"
+#include "pycore_bitutils.h"      // _Py_bswap32()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
+#include "pycore_tuple.h"         // _PyTuple_ITEMS()
 #include "structmember.h"         // PyMemberDef
 #include <ctype.h>
 
@@ -53,8 +55,29 @@ typedef struct _formatcode {
     Py_ssize_t offset;
     Py_ssize_t size;
     Py_ssize_t repeat;
+    int kind;                   /* how to unpack, one of UNPACK_* */
+    int swap;                   /* byte-swap integers and floats first */
 } formatcode;
 
+/* prepare_s() compiles every format code into one of these, so that
+   s_unpack_items() converts runs of the common integer and floating-point
+   types in a specialized loop.  The rest goes through fmtdef->unpack. */
+enum {
+    UNPACK_GENERIC,
+    UNPACK_STRING,
+    UNPACK_PASCAL,
+    UNPACK_INT8,
+    UNPACK_UINT8,
+    UNPACK_INT16,
+    UNPACK_UINT16,
+    UNPACK_INT32,
+    UNPACK_UINT32,
+    UNPACK_INT64,
+    UNPACK_UINT64,
+    UNPACK_FLOAT,
+    UNPACK_DOUBLE,
+};
+
 /* Struct object interface */
 
 typedef struct {
@@ -1293,6 +1316,53 @@ align(Py_ssize_t size, char c, const formatdef *e)
 
 /* calculate the size of a format string */
 
+/* Return the UNPACK_* kind for format character c of table f. */
+static int
+unpack_kind(char c, const formatdef *f, const formatdef *e)
+{
+    float fx = 1.5f;
+    double dx = 1.5;
+    uint32_t fbits;
+    uint64_t dbits;
+
+    switch (c) {
+    case 's':
+        return UNPACK_STRING;
+    case 'p':
+        return UNPACK_PASCAL;
+    case 'b':
+        return UNPACK_INT8;
+    case 'B':
+        return UNPACK_UINT8;
+    case 'h': case 'i': case 'l': case 'q': case 'n':
+    case 'H': case 'I': case 'L': case 'Q': case 'N': {
+        int is_signed = Py_ISLOWER(c);
+        switch (e->size) {
+        case 2:
+            return is_signed ? UNPACK_INT16 : UNPACK_UINT16;
+        case 4:
+            return is_signed ? UNPACK_INT32 : UNPACK_UINT32;
+        case 8:
+            return is_signed ? UNPACK_INT64 : UNPACK_UINT64;
+        }
+        break;
+    }
+    case 'f':
+    case 'd':
+        /* The standard sizes are IEEE 754; take the fast path only if the
+           host uses the same format, with the byte order of its integers. */
+        memcpy(&fbits, &fx, sizeof(fbits));
+        memcpy(&dbits, &dx, sizeof(dbits));
+        if (f == native_table
+            || (fbits == 0x3fc00000U && dbits == 0x3ff8000000000000ULL))
+        {
+            return c == 'f' ? UNPACK_FLOAT : UNPACK_DOUBLE;
+        }
+        break;
+    }
+    return UNPACK_GENERIC;
+}
+
 static int
 prepare_s(PyStructObject *self)
 {
@@ -1305,6 +1375,7 @@ prepare_s(PyStructObject *self)
     char c;
     Py_ssize_t size, len, num, itemsize;
     size_t ncodes;
+    int swap;
 
     _structmodulestate *state = get_struct_state_structinst(self);
 
@@ -1316,6 +1387,11 @@ prepare_s(PyStructObject *self)
     }
 
     f = whichtable(&fmt);
+#if PY_LITTLE_ENDIAN
+    swap = f == bigendian_table;
+#else
+    swap = f == lilendian_table;
+#endif
 
     s = fmt;
     size = 0;
@@ -1405,6 +1481,8 @@ prepare_s(PyStructObject *self)
             codes->size = num;
             codes->fmtdef = e;
             codes->repeat = 1;
+            codes->kind = unpack_kind(c, f, e);
+            codes->swap = 0;
             codes++;
             size += num;
         } else if (c == 'x') {
@@ -1414,6 +1492,8 @@ prepare_s(PyStructObject *self)
             codes->size = e->size;
             codes->fmtdef = e;
             codes->repeat = num;
+            codes->kind = unpack_kind(c, f, e);
+            codes->swap = swap;
             codes++;
             size += e->size * num;
         }
@@ -1422,6 +1502,8 @@ prepare_s(PyStructObject *self)
     codes->offset = size;
     codes->size = 0;
     codes->repeat = 0;
+    codes->kind = UNPACK_GENERIC;
+    codes->swap = 0;
 
     return 0;
 
@@ -1510,36 +1592,124 @@ s_dealloc(PyStructObject *s)
     Py_DECREF(tp);
 }
 
+/* Unpack the code->repeat items of code at p into items. */
+static int
+s_unpack_items(_structmodulestate *state, const formatcode *code,
+               const char *p, PyObject **items)
+{
+    const formatdef *e = code->fmtdef;
+    Py_ssize_t n = code->repeat;
+    int swap = code->swap;
+    PyObject *v;
+
+#define UNPACK_LOOP(type, bswap, convert)                       \
+    for (; n > 0; n--, p += sizeof(type)) {                     \
+        type x;                                                 \
+        memcpy(&x, p, sizeof(x));                               \
+        if (swap) {                                             \
+            x = bswap(x);                                       \
+        }                                                       \
+        v = convert;                                            \
+        if (v == NULL) {                                        \
+            return -1;                                          \
+        }                                                       \
+        *items++ = v;                                           \
+    }
+
+    switch (code->kind) {
+    case UNPACK_STRING:
+        v = PyBytes_FromStringAndSize(p, code->size);
+        if (v == NULL) {
+            return -1;
+        }
+        *items = v;
+        break;
+    case UNPACK_PASCAL: {
+        Py_ssize_t len = *(unsigned char *)p;
+        if (len >= code->size) {
+            len = code->size - 1;
+        }
+        v = PyBytes_FromStringAndSize(p + 1, len);
+        if (v == NULL) {
+            return -1;
+        }
+        *items = v;
+        break;
+    }
+    case UNPACK_INT8:
+    case UNPACK_UINT8:
+        for (; n > 0; n--, p++) {
+            if (code->kind == UNPACK_INT8) {
+                v = PyLong_FromLong(*(const signed char *)p);
+            }
+            else {
+                v = PyLong_FromLong(*(const unsigned char *)p);
+            }
+            if (v == NULL) {
+                return -1;
+            }
+            *items++ = v;
+        }
+        break;
+    case UNPACK_INT16:
+        UNPACK_LOOP(uint16_t, _Py_bswap16, PyLong_FromLong((int16_t)x))
+        break;
+    case UNPACK_UINT16:
+        UNPACK_LOOP(uint16_t, _Py_bswap16, PyLong_FromLong(x))
+        break;
+    case UNPACK_INT32:
+        UNPACK_LOOP(uint32_t, _Py_bswap32, PyLong_FromLong((int32_t)x))
+        break;
+    case UNPACK_UINT32:
+        UNPACK_LOOP(uint32_t, _Py_bswap32, PyLong_FromUnsignedLong(x))
+        break;
+    case UNPACK_INT64:
+        UNPACK_LOOP(uint64_t, _Py_bswap64,
+                    PyLong_FromLongLong((int64_t)x))
+        break;
+    case UNPACK_UINT64:
+        UNPACK_LOOP(uint64_t, _Py_bswap64, PyLong_FromUnsignedLongLong(x))
+        break;
+    case UNPACK_FLOAT: {
+        float f;
+        UNPACK_LOOP(uint32_t, _Py_bswap32,
+                    (memcpy(&f, &x, sizeof(f)), PyFloat_FromDouble(f)))
+        break;
+    }
+    case UNPACK_DOUBLE: {
+        double d;
+        UNPACK_LOOP(uint64_t, _Py_bswap64,
+                    (memcpy(&d, &x, sizeof(d)), PyFloat_FromDouble(d)))
+        break;
+    }
+    default:
+        for (; n > 0; n--, p += code->size) {
+            v = e->unpack(state, p, e);
+            if (v == NULL) {
+                return -1;
+            }
+            *items++ = v;
+        }
+        break;
+    }
+#undef UNPACK_LOOP
+    return 0;
+}
+
 static PyObject *
 s_unpack_internal(PyStructObject *soself, const char *startfrom,
                   _structmodulestate *state) {
     formatcode *code;
-    Py_ssize_t i = 0;
+    PyObject **items;
     PyObject *result = PyTuple_New(soself->s_len);
     if (result == NULL)
         return NULL;
 
+    items = _PyTuple_ITEMS(result);
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
-        const char *res = startfrom + code->offset;
-        Py_ssize_t j = code->repeat;
-        while (j--) {
-            PyObject *v;
-            if (e->format == 's') {
-                v = PyBytes_FromStringAndSize(res, code->size);
-            } else if (e->format == 'p') {
-                Py_ssize_t n = *(unsigned char*)res;
-                if (n >= code->size)
-                    n = code->size - 1;
-                v = PyBytes_FromStringAndSize(res + 1, n);
-            } else {
-                v = e->unpack(state, res, e);
-            }
-            if (v == NULL)
-                goto fail;
-            PyTuple_SET_ITEM(result, i++, v);
-            res += code->size;
-        }
+        if (s_unpack_items(state, code, startfrom + code->offset, items) < 0)
+            goto fail;
+        items += code->repeat;
     }
 
     return result;
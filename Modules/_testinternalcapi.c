@@ -18,6 +18,7 @@
 #include "pycore_hashtable.h"    // _Py_hashtable_new()
 #include "pycore_initconfig.h"   // _Py_GetConfigsAsDict()
 #include "pycore_interp.h"       // _PyInterpreterState_GetConfigCopy()
+#include "pycore_long.h"         // _PyLong_MulWithAlgorithm()
 #include "pycore_pyerrors.h"      // _Py_UTF8_Edit_Cost()
 
 
@@ -365,6 +366,20 @@ test_edit_cost(PyObject *self, PyObject *Py_UNUSED(args))
 }
 
 
+static PyObject *
+long_mul_with_algorithm(PyObject *self, PyObject *args)
+{
+    PyObject *a, *b;
+    int algorithm;
+
+    if (!PyArg_ParseTuple(args, "O!O!i:long_mul_with_algorithm",
+                          &PyLong_Type, &a, &PyLong_Type, &b, &algorithm)) {
+        return NULL;
+    }
+    return _PyLong_MulWithAlgorithm(a, b, algorithm);
+}
+
+
 static PyMethodDef TestMethods[] = {
     {"get_configs", get_configs, METH_NOARGS},
     {"get_recursion_depth", get_recursion_depth, METH_NOARGS},
@@ -376,6 +391,7 @@ static PyMethodDef TestMethods[] = {
     {"set_config", test_set_config, METH_O},
     {"test_atomic_funcs", test_atomic_funcs, METH_NOARGS},
     {"test_edit_cost", test_edit_cost, METH_NOARGS},
+    {"long_mul_with_algorithm", long_mul_with_algorithm, METH_VARARGS},
     {NULL, NULL} /* sentinel */
 };
 
@@ -53,9 +53,15 @@
 ** Brandon Long, September 2001.
 */
 
+#if !defined(Py_BUILD_CORE_BUILTIN) && !defined(Py_BUILD_CORE_MODULE)
+#  error "Py_BUILD_CORE_BUILTIN or Py_BUILD_CORE_MODULE must be defined"
+#endif
+
 #define PY_SSIZE_T_CLEAN
 
 #include "Python.h"
+#include "pycore_bitutils.h"      // _Py_bswap32()
+#include "pycore_simd.h"          // _Py_in_range_epi8()
 #include "pystrhex.h"
 #ifdef USE_ZLIB_CRC32
 #include "zlib.h"
@@ -101,6 +107,91 @@ static const unsigned char table_a2b_base64[] = {
 static const unsigned char table_b2a_base64[] =
 "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+#ifdef _Py_HAVE_SSE2
+/* SSE2 kernels for base64, after Wojciech Mula and Daniel Lemire, "Faster
+   Base64 Encoding and Decoding Using AVX2 Instructions" (2018), with the
+   byte shuffles done by shifts and masks since SSE2 has no pshufb.  The
+   characters are mapped to and from 6-bit values by range checks.  x86 is
+   little-endian, so 24-bit groups are byte swapped on the way. */
+
+/* Encode 12 bytes at src (reading 16) into 16 characters at dst. */
+static inline void
+base64_encode_block(const unsigned char *src, unsigned char *dst)
+{
+    uint32_t groups[4];
+    int k;
+    for (k = 0; k < 4; k++) {
+        uint32_t word;
+        memcpy(&word, src + 3*k, 4);
+        groups[k] = _Py_bswap32(word) >> 8;
+    }
+    /* Each 32-bit lane holds 24 bits; spread them into four bytes of six
+       bits, first sextet in the lowest byte. */
+    __m128i x = _mm_loadu_si128((const __m128i *)groups);
+    __m128i v = _mm_or_si128(
+        _mm_or_si128(_mm_srli_epi32(x, 18),
+                     _mm_and_si128(_mm_srli_epi32(x, 4),
+                                   _mm_set1_epi32(0x00003f00))),
+        _mm_or_si128(_mm_and_si128(_mm_slli_epi32(x, 10),
+                                   _mm_set1_epi32(0x003f0000)),
+                     _mm_and_si128(_mm_slli_epi32(x, 24),
+                                   _mm_set1_epi32(0x3f000000))));
+    /* 0-25 -> 'A'-'Z', 26-51 -> 'a'-'z', 52-61 -> '0'-'9', 62 -> '+',
+       63 -> '/' */
+    __m128i offset = _mm_set1_epi8('A');
+    offset = _mm_add_epi8(offset, _mm_and_si128(
+        _mm_cmpgt_epi8(v, _mm_set1_epi8(25)), _mm_set1_epi8('a' - 26 - 'A')));
+    offset = _mm_add_epi8(offset, _mm_and_si128(
+        _mm_cmpgt_epi8(v, _mm_set1_epi8(51)), _mm_set1_epi8('0' - 52 - 'a' + 26)));
+    offset = _mm_add_epi8(offset, _mm_and_si128(
+        _mm_cmpeq_epi8(v, _mm_set1_epi8(62)), _mm_set1_epi8('+' - 62 - '0' + 52)));
+    offset = _mm_add_epi8(offset, _mm_and_si128(
+        _mm_cmpeq_epi8(v, _mm_set1_epi8(63)), _mm_set1_epi8('/' - 63 - '0' + 52)));
+    _mm_storeu_si128((__m128i *)dst, _mm_add_epi8(v, offset));
+}
+
+/* Decode 16 characters at src into 12 bytes at dst (writing 13).  Return
+   -1 on success, or the index of the first character that is not in the
+   base64 alphabet, in which case nothing is written. */
+static inline int
+base64_decode_block(const unsigned char *src, unsigned char *dst)
+{
+    __m128i chars = _mm_loadu_si128((const __m128i *)src);
+    __m128i upper = _Py_in_range_epi8(chars, 'A', 'Z');
+    __m128i lower = _Py_in_range_epi8(chars, 'a', 'z');
+    __m128i digit = _Py_in_range_epi8(chars, '0', '9');
+    __m128i plus = _mm_cmpeq_epi8(chars, _mm_set1_epi8('+'));
+    __m128i slash = _mm_cmpeq_epi8(chars, _mm_set1_epi8('/'));
+    __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                                 _mm_or_si128(_mm_or_si128(digit, plus), slash));
+    int mask = _mm_movemask_epi8(valid);
+    if (mask != 0xFFFF) {
+        return _Py_ctz32((uint32_t)~mask);
+    }
+    __m128i offset = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                     _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+        _mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+                     _mm_or_si128(_mm_and_si128(plus, _mm_set1_epi8(62 - '+')),
+                                  _mm_and_si128(slash, _mm_set1_epi8(63 - '/')))));
+    __m128i v = _mm_add_epi8(chars, offset);
+    /* Join the sextets a, b, c, d of each 32-bit lane into 24 bits: first
+       ab and cd in the 16-bit halves, then abcd. */
+    v = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x00ff)), 6),
+                     _mm_srli_epi16(v, 8));
+    v = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xffff)), 12),
+                     _mm_srli_epi32(v, 16));
+    uint32_t groups[4];
+    int k;
+    _mm_storeu_si128((__m128i *)groups, v);
+    for (k = 0; k < 4; k++) {
+        uint32_t word = _Py_bswap32(groups[k] << 8);
+        memcpy(dst + 3*k, &word, 4);
+    }
+    return -1;
+}
+#endif
+
 
 static const unsigned short crctab_hqx[256] = {
     0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
@@ -410,7 +501,28 @@ binascii_a2b_base64_impl(PyObject *module, Py_buffer *data, int strict_mode)
     int quad_pos = 0;
     unsigned char leftchar = 0;
     int pads = 0;
+#ifdef _Py_HAVE_SSE2
+    /* Don't retry the block decoder before this index. */
+    size_t simd_start = 0;
+#endif
     for (size_t i = 0; i < ascii_len; i++) {
+#ifdef _Py_HAVE_SSE2
+        /* Decode whole blocks of 16 base64 characters at quad boundaries.
+           The block decoder writes one byte past its output, which stays
+           within bin_len as long as more input follows. */
+        while (quad_pos == 0 && i >= simd_start && ascii_len - i > 16
+               && !(strict_mode && padding_started))
+        {
+            int bad = base64_decode_block(ascii_data + i, bin_data);
+            if (bad >= 0) {
+                simd_start = i + bad + 1;
+                break;
+            }
+            i += 16;
+            bin_data += 12;
+            pads = 0;
+        }
+#endif
         unsigned char this_ch = ascii_data[i];
 
         /* Check for pad sequences and ignore
@@ -559,6 +671,13 @@ binascii_b2a_base64_impl(PyObject *module, Py_buffer *data, int newline)
     if (ascii_data == NULL)
         return NULL;
 
+#ifdef _Py_HAVE_SSE2
+    /* Encode 12 bytes at a time; the block encoder reads 16. */
+    for ( ; bin_len >= 16 ; bin_len -= 12, bin_data += 12) {
+        base64_encode_block(bin_data, ascii_data);
+        ascii_data += 16;
+    }
+#endif
     for( ; bin_len > 0 ; bin_len--, bin_data++ ) {
         /* Shift the data into our buffer */
         leftchar = (leftchar << 8) | *bin_data;
@@ -734,6 +853,273 @@ static const unsigned int crc_32_tab[256] = {
 };
 #endif  /* USE_ZLIB_CRC32 */
 
+/* Bit-reflected CRC-32 (ISO 3309) and CRC-32C (Castagnoli) polynomials. */
+#define CRC32_POLY 0xedb88320U
+#define CRC32C_POLY 0x82f63b78U
+
+/* Releasing the GIL for very small buffers is inefficient and may lower
+   performance; use the same threshold as the zlib module. */
+#define CRC_GIL_MINSIZE (5 * 1024)
+
+/* crc32c_table[k][b] is the CRC-32C register after byte b followed by k
+   zero bytes, for slicing-by-8.  Filled in by crc_init(), as are the CPU
+   feature flags. */
+static uint32_t crc32c_table[8][256];
+static int crc_initialized = 0;
+#ifdef _Py_HAVE_X86_TARGET
+static int have_pclmul = 0;
+static int have_sse42 = 0;
+
+/* Block size of the three streams of crc32c_sse42(), and the factors
+   shifting a CRC-32C register over one and two blocks. */
+#define CRC32C_BLOCK 4096
+static uint32_t crc32c_shift1, crc32c_shift2;
+#endif
+
+/* Return a(x) * b(x) modulo the bit-reflected polynomial poly.  a must not
+   be zero. */
+static uint32_t
+crc_multmodp(uint32_t a, uint32_t b, uint32_t poly)
+{
+    uint32_t m = 1U << 31, p = 0;
+
+    assert(a != 0);
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) {
+                break;
+            }
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ poly : b >> 1;
+    }
+    return p;
+}
+
+/* Return x**(8 * n) modulo poly: multiplying a CRC register by it has the
+   same effect as feeding it n zero bytes. */
+static uint32_t
+crc_x8nmodp(Py_ssize_t n, uint32_t poly)
+{
+    uint32_t xp = 1U << 31;         /* x**0 */
+    uint32_t sq = 1U << 23;         /* x**8 */
+
+    assert(n >= 0);
+    for (; n > 0; n >>= 1) {
+        if (n & 1) {
+            xp = crc_multmodp(sq, xp, poly);
+        }
+        sq = crc_multmodp(sq, sq, poly);
+    }
+    return xp;
+}
+
+/* Return the CRC of the concatenation of two chunks, given their CRCs and
+   the length of the second one. */
+static uint32_t
+crc_combine(uint32_t crc1, uint32_t crc2, Py_ssize_t len2, uint32_t poly)
+{
+    return crc_multmodp(crc_x8nmodp(len2, poly), crc1, poly) ^ crc2;
+}
+
+static void
+crc_init(void)
+{
+    if (crc_initialized) {
+        return;
+    }
+    for (uint32_t b = 0; b < 256; b++) {
+        uint32_t crc = b;
+        for (int i = 0; i < 8; i++) {
+            crc = crc & 1 ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+        }
+        crc32c_table[0][b] = crc;
+    }
+    for (int b = 0; b < 256; b++) {
+        uint32_t crc = crc32c_table[0][b];
+        for (int k = 1; k < 8; k++) {
+            crc = crc32c_table[0][crc & 0xff] ^ (crc >> 8);
+            crc32c_table[k][b] = crc;
+        }
+    }
+#ifdef _Py_HAVE_X86_TARGET
+    have_pclmul = _Py_CPU_SUPPORTS("pclmul");
+    have_sse42 = _Py_CPU_SUPPORTS("sse4.2");
+    crc32c_shift1 = crc_x8nmodp(CRC32C_BLOCK, CRC32C_POLY);
+    crc32c_shift2 = crc_x8nmodp(2 * CRC32C_BLOCK, CRC32C_POLY);
+#endif
+    crc_initialized = 1;
+}
+
+#ifdef _Py_HAVE_X86_TARGET
+/* Multiply the low and high quadwords of x by those of k and xor both
+   products into z: this moves the 128 bits of x forward over z. */
+_Py_TARGET("pclmul") static inline __m128i
+crc32_fold(__m128i x, __m128i k, __m128i z)
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                                       _mm_clmulepi64_si128(x, k, 0x11)),
+                         z);
+}
+
+/* Update the inverted CRC-32 register crc with len bytes, a multiple of 16
+   and at least 64, by folding with carry-less multiplication as described
+   in Intel's "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+   Instruction".  The constants are bit-reflected and shifted left by one:
+   k1, k2, k3, k4 and k5 are x**(4*128+32), x**(4*128-32), x**(128+32),
+   x**(128-32) and x**64 modulo P, and mu is x**64 / P. */
+_Py_TARGET("pclmul") static uint32_t
+crc32_pclmul(uint32_t crc, const unsigned char *buf, Py_ssize_t len)
+{
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5 = _mm_set_epi64x(0, 0x0163cd6124);
+    const __m128i poly_mu = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+    const __m128i *p = (const __m128i *)buf;
+    __m128i x0, x1, x2, x3, t;
+
+    assert(len >= 64 && len % 16 == 0);
+    x0 = _mm_xor_si128(_mm_loadu_si128(p), _mm_cvtsi32_si128((int)crc));
+    x1 = _mm_loadu_si128(p + 1);
+    x2 = _mm_loadu_si128(p + 2);
+    x3 = _mm_loadu_si128(p + 3);
+    for (p += 4, len -= 64; len >= 64; p += 4, len -= 64) {
+        x0 = crc32_fold(x0, k1k2, _mm_loadu_si128(p));
+        x1 = crc32_fold(x1, k1k2, _mm_loadu_si128(p + 1));
+        x2 = crc32_fold(x2, k1k2, _mm_loadu_si128(p + 2));
+        x3 = crc32_fold(x3, k1k2, _mm_loadu_si128(p + 3));
+    }
+    x0 = crc32_fold(x0, k3k4, x1);
+    x0 = crc32_fold(x0, k3k4, x2);
+    x0 = crc32_fold(x0, k3k4, x3);
+    for (; len >= 16; p++, len -= 16) {
+        x0 = crc32_fold(x0, k3k4, _mm_loadu_si128(p));
+    }
+
+    /* Reduce 128 bits to 64, then to 32, then Barrett-reduce modulo P. */
+    t = _mm_clmulepi64_si128(x0, k3k4, 0x10);
+    x0 = _mm_xor_si128(_mm_srli_si128(x0, 8), t);
+    t = _mm_srli_si128(x0, 4);
+    x0 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), k5, 0x00);
+    x0 = _mm_xor_si128(x0, t);
+    t = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), poly_mu, 0x10);
+    t = _mm_clmulepi64_si128(_mm_and_si128(t, mask32), poly_mu, 0x00);
+    x0 = _mm_xor_si128(x0, t);
+    return (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x0, 4));
+}
+
+/* Update the inverted CRC-32C register crc with the crc32 instruction, for
+   len bytes starting at a multiple of 8. */
+_Py_TARGET("sse4.2") static inline uint32_t
+crc32c_sse42_words(uint32_t crc, const unsigned char *buf, Py_ssize_t len)
+{
+#ifdef __x86_64__
+    for (; len >= 8; len -= 8, buf += 8) {
+        uint64_t word;
+        memcpy(&word, buf, 8);
+        crc = (uint32_t)_mm_crc32_u64(crc, word);
+    }
+#endif
+    for (; len >= 4; len -= 4, buf += 4) {
+        uint32_t word;
+        memcpy(&word, buf, 4);
+        crc = _mm_crc32_u32(crc, word);
+    }
+    for (; len > 0; len--) {
+        crc = _mm_crc32_u8(crc, *buf++);
+    }
+    return crc;
+}
+
+_Py_TARGET("sse4.2") static uint32_t
+crc32c_sse42(uint32_t crc, const unsigned char *buf, Py_ssize_t len)
+{
+    for (; len > 0 && ((uintptr_t)buf & 7); len--) {
+        crc = _mm_crc32_u8(crc, *buf++);
+    }
+    /* The crc32 instruction has a latency of three cycles, so run three
+       independent streams over consecutive blocks and merge them. */
+#ifdef __x86_64__
+    for (; len >= 3 * CRC32C_BLOCK; len -= 3 * CRC32C_BLOCK) {
+        uint64_t crc0 = crc, crc1 = 0, crc2 = 0;
+        const unsigned char *end = buf + CRC32C_BLOCK;
+        for (; buf < end; buf += 8) {
+            uint64_t word0, word1, word2;
+            memcpy(&word0, buf, 8);
+            memcpy(&word1, buf + CRC32C_BLOCK, 8);
+            memcpy(&word2, buf + 2 * CRC32C_BLOCK, 8);
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+        }
+        crc = crc_multmodp(crc32c_shift2, (uint32_t)crc0, CRC32C_POLY) ^
+              crc_multmodp(crc32c_shift1, (uint32_t)crc1, CRC32C_POLY) ^
+              (uint32_t)crc2;
+        buf += 2 * CRC32C_BLOCK;
+    }
+#endif
+    return crc32c_sse42_words(crc, buf, len);
+}
+#endif  /* _Py_HAVE_X86_TARGET */
+
+static uint32_t
+crc32_update(uint32_t crc, const unsigned char *buf, Py_ssize_t len)
+{
+#ifdef _Py_HAVE_X86_TARGET
+    if (len >= 64 && have_pclmul) {
+        Py_ssize_t n = len & ~(Py_ssize_t)15;
+        crc = ~crc32_pclmul(~crc, buf, n);
+        buf += n;
+        len -= n;
+    }
+#endif
+#ifdef USE_ZLIB_CRC32
+    /* crc32() takes an unsigned int length. */
+    while ((size_t)len > UINT_MAX) {
+        crc = (uint32_t)crc32(crc, buf, UINT_MAX);
+        buf += (size_t)UINT_MAX;
+        len -= (size_t)UINT_MAX;
+    }
+    crc = (uint32_t)crc32(crc, buf, (unsigned int)len);
+#else
+    /* By Jim Ahlstrom; All rights transferred to CNRI */
+    crc = ~crc;
+    while (len-- > 0) {
+        crc = crc_32_tab[(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+        /* Note:  (crc >> 8) MUST zero fill on left */
+    }
+    crc = ~crc;
+#endif
+    return crc & 0xffffffffU;
+}
+
+static uint32_t
+crc32c_update(uint32_t crc, const unsigned char *buf, Py_ssize_t len)
+{
+    crc = ~crc;
+#ifdef _Py_HAVE_X86_TARGET
+    if (have_sse42) {
+        return ~crc32c_sse42(crc, buf, len);
+    }
+#endif
+    for (; len >= 8; len -= 8, buf += 8) {
+        uint32_t low = crc ^ ((uint32_t)buf[0] | (uint32_t)buf[1] << 8 |
+                              (uint32_t)buf[2] << 16 | (uint32_t)buf[3] << 24);
+        crc = crc32c_table[7][low & 0xff] ^
+              crc32c_table[6][(low >> 8) & 0xff] ^
+              crc32c_table[5][(low >> 16) & 0xff] ^
+              crc32c_table[4][low >> 24] ^
+              crc32c_table[3][buf[4]] ^ crc32c_table[2][buf[5]] ^
+              crc32c_table[1][buf[6]] ^ crc32c_table[0][buf[7]];
+    }
+    for (; len > 0; len--) {
+        crc = crc32c_table[0][(crc ^ *buf++) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
 /*[clinic input]
 binascii.crc32 -> unsigned_int
 
@@ -747,38 +1133,94 @@ Compute CRC-32 incrementally.
 static unsigned int
 binascii_crc32_impl(PyObject *module, Py_buffer *data, unsigned int crc)
 /*[clinic end generated code: output=52cf59056a78593b input=bbe340bc99d25aa8]*/
-
-#ifdef USE_ZLIB_CRC32
-/* This was taken from zlibmodule.c PyZlib_crc32 (but is PY_SSIZE_T_CLEAN) */
 {
-    const Byte *buf;
-    Py_ssize_t len;
-    int signed_val;
+    if (data->len > CRC_GIL_MINSIZE) {
+        Py_BEGIN_ALLOW_THREADS
+        crc = crc32_update(crc, data->buf, data->len);
+        Py_END_ALLOW_THREADS
+    }
+    else {
+        crc = crc32_update(crc, data->buf, data->len);
+    }
+    return crc;
+}
 
-    buf = (Byte*)data->buf;
-    len = data->len;
-    signed_val = crc32(crc, buf, len);
-    return (unsigned int)signed_val & 0xffffffffU;
+/*[clinic input]
+binascii.crc32c -> unsigned_int
+
+    data: Py_buffer
+    crc: unsigned_int(bitwise=True) = 0
+    /
+
+Compute CRC-32C (Castagnoli) incrementally.
+[clinic start generated code]*/
+
+static unsigned int
+binascii_crc32c_impl(PyObject *module, Py_buffer *data, unsigned int crc)
+/*[clinic end generated code: output=c28af99337083bf0 input=7041d16b8a6a29eb]*/
+{
+    if (data->len > CRC_GIL_MINSIZE) {
+        Py_BEGIN_ALLOW_THREADS
+        crc = crc32c_update(crc, data->buf, data->len);
+        Py_END_ALLOW_THREADS
+    }
+    else {
+        crc = crc32c_update(crc, data->buf, data->len);
+    }
+    return crc;
 }
-#else  /* USE_ZLIB_CRC32 */
-{ /* By Jim Ahlstrom; All rights transferred to CNRI */
-    const unsigned char *bin_data;
-    Py_ssize_t len;
-    unsigned int result;
 
-    bin_data = data->buf;
-    len = data->len;
+/*[clinic input]
+binascii.crc32_combine -> unsigned_int
 
-    crc = ~ crc;
-    while (len-- > 0) {
-        crc = crc_32_tab[(crc ^ *bin_data++) & 0xff] ^ (crc >> 8);
-        /* Note:  (crc >> 8) MUST zero fill on left */
+    crc1: unsigned_int(bitwise=True)
+    crc2: unsigned_int(bitwise=True)
+    length: Py_ssize_t
+    /
+
+Combine the CRC-32 values of two consecutive chunks of data.
+
+Return crc32(a + b), given crc1 = crc32(a), crc2 = crc32(b) and
+length = len(b).
+[clinic start generated code]*/
+
+static unsigned int
+binascii_crc32_combine_impl(PyObject *module, unsigned int crc1,
+                            unsigned int crc2, Py_ssize_t length)
+/*[clinic end generated code: output=bdd2d9a6a0620791 input=3eb446cbd739a6a3]*/
+{
+    if (length < 0) {
+        PyErr_SetString(PyExc_ValueError, "length must be non-negative");
+        return (unsigned int)-1;
     }
+    return crc_combine(crc1, crc2, length, CRC32_POLY);
+}
 
-    result = (crc ^ 0xFFFFFFFF);
-    return result & 0xffffffff;
+/*[clinic input]
+binascii.crc32c_combine -> unsigned_int
+
+    crc1: unsigned_int(bitwise=True)
+    crc2: unsigned_int(bitwise=True)
+    length: Py_ssize_t
+    /
+
+Combine the CRC-32C values of two consecutive chunks of data.
+
+Return crc32c(a + b), given crc1 = crc32c(a), crc2 = crc32c(b) and
+length = len(b).
+[clinic start generated code]*/
+
+static unsigned int
+binascii_crc32c_combine_impl(PyObject *module, unsigned int crc1,
+                             unsigned int crc2, Py_ssize_t length)
+/*[clinic end generated code: output=d8757bcc3e7485f4 input=363af42f78513f79]*/
+{
+    if (length < 0) {
+        PyErr_SetString(PyExc_ValueError, "length must be non-negative");
+        return (unsigned int)-1;
+    }
+    return crc_combine(crc1, crc2, length, CRC32C_POLY);
 }
-#endif  /* USE_ZLIB_CRC32 */
 
 /*[clinic input]
 binascii.b2a_hex
@@ -851,7 +1293,6 @@ binascii_a2b_hex_impl(PyObject *module, Py_buffer *hexstr)
     Py_ssize_t arglen;
     PyObject *retval;
     char* retbuf;
-    Py_ssize_t i, j;
     binascii_state *state;
 
     argbuf = hexstr->buf;
@@ -877,19 +1318,14 @@ binascii_a2b_hex_impl(PyObject *module, Py_buffer *hexstr)
         return NULL;
     retbuf = PyBytes_AS_STRING(retval);
 
-    for (i=j=0; i < arglen; i += 2) {
-        unsigned int top = _PyLong_DigitValue[Py_CHARMASK(argbuf[i])];
-        unsigned int bot = _PyLong_DigitValue[Py_CHARMASK(argbuf[i+1])];
-        if (top >= 16 || bot >= 16) {
-            state = get_binascii_state(module);
-            if (state == NULL) {
-                return NULL;
-            }
-            PyErr_SetString(state->Error,
-                            "Non-hexadecimal digit found");
+    if (_Py_strunhex(argbuf, arglen, retbuf) != arglen) {
+        state = get_binascii_state(module);
+        if (state == NULL) {
             goto finally;
         }
-        retbuf[j++] = (top << 4) + bot;
+        PyErr_SetString(state->Error,
+                        "Non-hexadecimal digit found");
+        goto finally;
     }
     return retval;
 
@@ -1221,6 +1657,9 @@ static struct PyMethodDef binascii_module_methods[] = {
     BINASCII_UNHEXLIFY_METHODDEF
     BINASCII_CRC_HQX_METHODDEF
     BINASCII_CRC32_METHODDEF
+    BINASCII_CRC32C_METHODDEF
+    BINASCII_CRC32_COMBINE_METHODDEF
+    BINASCII_CRC32C_COMBINE_METHODDEF
     BINASCII_A2B_QP_METHODDEF
     BINASCII_B2A_QP_METHODDEF
     {NULL, NULL}                             /* sentinel */
@@ -1238,6 +1677,8 @@ binascii_exec(PyObject *module) {
         return -1;
     }
 
+    crc_init();
+
     state->Error = PyErr_NewException("binascii.Error", PyExc_ValueError, NULL);
     if (state->Error == NULL) {
         return -1;
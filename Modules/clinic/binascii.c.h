@@ -288,6 +288,175 @@ binascii_crc32(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
     return return_value;
 }
 
+PyDoc_STRVAR(binascii_crc32c__doc__,
+"crc32c($module, data, crc=0, /)\n"
+"--\n"
+"\n"
+"Compute CRC-32C (Castagnoli) incrementally.");
+
+#define BINASCII_CRC32C_METHODDEF    \
+    {"crc32c", (PyCFunction)(void(*)(void))binascii_crc32c, METH_FASTCALL, binascii_crc32c__doc__},
+
+static unsigned int
+binascii_crc32c_impl(PyObject *module, Py_buffer *data, unsigned int crc);
+
+static PyObject *
+binascii_crc32c(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer data = {NULL, NULL};
+    unsigned int crc = 0;
+    unsigned int _return_value;
+
+    if (!_PyArg_CheckPositional("crc32c", nargs, 1, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&data, 'C')) {
+        _PyArg_BadArgument("crc32c", "argument 1", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    crc = (unsigned int)PyLong_AsUnsignedLongMask(args[1]);
+    if (crc == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    _return_value = binascii_crc32c_impl(module, &data, crc);
+    if ((_return_value == (unsigned int)-1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromUnsignedLong((unsigned long)_return_value);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(binascii_crc32_combine__doc__,
+"crc32_combine($module, crc1, crc2, length, /)\n"
+"--\n"
+"\n"
+"Combine the CRC-32 values of two consecutive chunks of data.\n"
+"\n"
+"Return crc32(a + b), given crc1 = crc32(a), crc2 = crc32(b) and\n"
+"length = len(b).");
+
+#define BINASCII_CRC32_COMBINE_METHODDEF    \
+    {"crc32_combine", (PyCFunction)(void(*)(void))binascii_crc32_combine, METH_FASTCALL, binascii_crc32_combine__doc__},
+
+static unsigned int
+binascii_crc32_combine_impl(PyObject *module, unsigned int crc1,
+                            unsigned int crc2, Py_ssize_t length);
+
+static PyObject *
+binascii_crc32_combine(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    unsigned int crc1;
+    unsigned int crc2;
+    Py_ssize_t length;
+    unsigned int _return_value;
+
+    if (!_PyArg_CheckPositional("crc32_combine", nargs, 3, 3)) {
+        goto exit;
+    }
+    crc1 = (unsigned int)PyLong_AsUnsignedLongMask(args[0]);
+    if (crc1 == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    crc2 = (unsigned int)PyLong_AsUnsignedLongMask(args[1]);
+    if (crc2 == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[2]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        length = ival;
+    }
+    _return_value = binascii_crc32_combine_impl(module, crc1, crc2, length);
+    if ((_return_value == (unsigned int)-1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromUnsignedLong((unsigned long)_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(binascii_crc32c_combine__doc__,
+"crc32c_combine($module, crc1, crc2, length, /)\n"
+"--\n"
+"\n"
+"Combine the CRC-32C values of two consecutive chunks of data.\n"
+"\n"
+"Return crc32c(a + b), given crc1 = crc32c(a), crc2 = crc32c(b) and\n"
+"length = len(b).");
+
+#define BINASCII_CRC32C_COMBINE_METHODDEF    \
+    {"crc32c_combine", (PyCFunction)(void(*)(void))binascii_crc32c_combine, METH_FASTCALL, binascii_crc32c_combine__doc__},
+
+static unsigned int
+binascii_crc32c_combine_impl(PyObject *module, unsigned int crc1,
+                             unsigned int crc2, Py_ssize_t length);
+
+static PyObject *
+binascii_crc32c_combine(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    unsigned int crc1;
+    unsigned int crc2;
+    Py_ssize_t length;
+    unsigned int _return_value;
+
+    if (!_PyArg_CheckPositional("crc32c_combine", nargs, 3, 3)) {
+        goto exit;
+    }
+    crc1 = (unsigned int)PyLong_AsUnsignedLongMask(args[0]);
+    if (crc1 == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    crc2 = (unsigned int)PyLong_AsUnsignedLongMask(args[1]);
+    if (crc2 == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[2]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        length = ival;
+    }
+    _return_value = binascii_crc32c_combine_impl(module, crc1, crc2, length);
+    if ((_return_value == (unsigned int)-1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromUnsignedLong((unsigned long)_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(binascii_b2a_hex__doc__,
 "b2a_hex($module, /, data, sep=<unrepresentable>, bytes_per_sep=1)\n"
 "--\n"
@@ -628,4 +797,4 @@ binascii_b2a_qp(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObj
 
     return return_value;
 }
-/*[clinic end generated code: output=4162d08536697182 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=0d46ed9cf84f1473 input=a9049054013a1b77]*/
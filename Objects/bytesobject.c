@@ -2415,6 +2415,14 @@ _PyBytes_FromHex(PyObject *string, int use_bytearray)
 
     end = str + hexlen;
     while (str < end) {
+        /* decode the run of hex digit pairs up to the next space or
+           invalid character */
+        Py_ssize_t consumed = _Py_strunhex((const char *)str, end - str, buf);
+        str += consumed;
+        buf += consumed / 2;
+        if (str >= end)
+            break;
+
         /* skip over spaces in the input */
         if (Py_ISSPACE(*str)) {
             do {
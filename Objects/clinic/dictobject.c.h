@@ -36,6 +36,77 @@ dict_fromkeys(PyTypeObject *type, PyObject *const *args, Py_ssize_t nargs)
     return return_value;
 }
 
+PyDoc_STRVAR(dict_from_pairs__doc__,
+"from_pairs($type, keys, values, /)\n"
+"--\n"
+"\n"
+"Create a new dictionary mapping the items of keys to the items of values.\n"
+"\n"
+"keys and values are iterables of the same length: each item of keys is\n"
+"mapped to the item of values at the same position.");
+
+#define DICT_FROM_PAIRS_METHODDEF    \
+    {"from_pairs", (PyCFunction)(void(*)(void))dict_from_pairs, METH_FASTCALL|METH_CLASS, dict_from_pairs__doc__},
+
+static PyObject *
+dict_from_pairs_impl(PyTypeObject *type, PyObject *keys, PyObject *values);
+
+static PyObject *
+dict_from_pairs(PyTypeObject *type, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *keys;
+    PyObject *values;
+
+    if (!_PyArg_CheckPositional("from_pairs", nargs, 2, 2)) {
+        goto exit;
+    }
+    keys = args[0];
+    values = args[1];
+    return_value = dict_from_pairs_impl(type, keys, values);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(dict_with_capacity__doc__,
+"with_capacity($type, n, /)\n"
+"--\n"
+"\n"
+"Create a new empty dictionary with room for n items.\n"
+"\n"
+"Inserting up to n items into the dictionary does not resize it.");
+
+#define DICT_WITH_CAPACITY_METHODDEF    \
+    {"with_capacity", (PyCFunction)dict_with_capacity, METH_O|METH_CLASS, dict_with_capacity__doc__},
+
+static PyObject *
+dict_with_capacity_impl(PyTypeObject *type, Py_ssize_t n);
+
+static PyObject *
+dict_with_capacity(PyTypeObject *type, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t n;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        n = ival;
+    }
+    return_value = dict_with_capacity_impl(type, n);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(dict___contains____doc__,
 "__contains__($self, key, /)\n"
 "--\n"
@@ -191,4 +262,4 @@ dict___reversed__(PyDictObject *self, PyObject *Py_UNUSED(ignored))
 {
     return dict___reversed___impl(self);
 }
-/*[clinic end generated code: output=7b77c16e43d6735a input=a9049054013a1b77]*/
+/*[clinic end generated code: output=eba4383ebde68071 input=a9049054013a1b77]*/
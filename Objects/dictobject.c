@@ -60,7 +60,8 @@ The DictObject can be in one of two forms.
     ma_values != NULL, dk_refcnt >= 1
     Values are stored in the ma_values array.
     Only string (unicode) keys are allowed.
-    All dicts sharing same key must have same insertion order.
+    All dicts sharing same key must have same insertion order, but a dict
+    need not have a value for every key.
 
 There are four kinds of slots in the table (slot is index, and
 DK_ENTRIES(keys)[index] if index >= 0):
@@ -82,7 +83,7 @@ DK_ENTRIES(keys)[index] if index >= 0):
    they were once active.
 
 4. Pending. index >= 0, key != NULL, and value == NULL  (split only)
-   Not yet inserted in split-table.
+   Not yet inserted in split-table, or deleted from it.
 */
 
 /*
@@ -96,9 +97,14 @@ dk_nentries to achieve amortized O(1).  Since there are DKIX_DUMMY remains in
 dk_indices, we can't increment dk_usable even though dk_nentries is
 decremented.
 
-In split table, inserting into pending entry is allowed only for dk_entries[ix]
-where ix == mp->ma_used. Inserting into other index and deleting item cause
-converting the dict to the combined table.
+In split table, the order of the values is the order of dk_entries, so
+inserting into a pending entry is allowed only when no value follows it.  New
+keys are appended to the shared keys and can always be inserted.  The dict API
+also requires ix == mp->ma_used when inserting into a pending entry and
+converts the dict to the combined table to delete an item.  Setting and
+deleting attributes of an instance leaves pending entries instead, so that
+instances which set attributes conditionally, or delete them, keep sharing the
+keys of their class; only inserting out of order converts the dict.
 */
 
 /* PyDict_MINSIZE is the starting size for any new dict.
@@ -518,9 +524,11 @@ _PyDict_CheckConsistency(PyObject *op, int check_content)
 
         if (splitted) {
             /* splitted table */
-            for (i=0; i < mp->ma_used; i++) {
-                CHECK(mp->ma_values[i] != NULL);
+            Py_ssize_t used = 0;
+            for (i=0; i < keys->dk_nentries; i++) {
+                used += (mp->ma_values[i] != NULL);
             }
+            CHECK(used == mp->ma_used);
         }
     }
     return 1;
@@ -537,7 +545,7 @@ new_keys_object(uint8_t log2_size)
 
     assert(log2_size >= PyDict_LOG_MINSIZE);
 
-    usable = USABLE_FRACTION(1<<log2_size);
+    usable = USABLE_FRACTION(((Py_ssize_t)1)<<log2_size);
     if (log2_size <= 7) {
         es = 1;
     }
@@ -1001,9 +1009,8 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
     /* When insertion order is different from shared key, we can't share
      * the key anymore.  Convert this instance to combine table.
      */
-    if (_PyDict_HasSplitTable(mp) &&
-        ((ix >= 0 && old_value == NULL && mp->ma_used != ix) ||
-         (ix == DKIX_EMPTY && mp->ma_used != mp->ma_keys->dk_nentries))) {
+    if (_PyDict_HasSplitTable(mp) && ix >= 0 && old_value == NULL &&
+        (mp->ma_used != ix || !_PyDict_SplitSlotInOrder(mp, ix))) {
         if (insertion_resize(mp) < 0)
             goto Fail;
         ix = DKIX_EMPTY;
@@ -1170,16 +1177,20 @@ dictresize(PyDictObject *mp, uint8_t log2_newsize)
     if (oldvalues != NULL) {
         /* Convert split table into new combined table.
          * We must incref keys; we can transfer values.
-         * Note that values of split table is always dense.
+         * Note that values of split table can have holes.
          */
-        for (Py_ssize_t i = 0; i < numentries; i++) {
-            assert(oldvalues[i] != NULL);
+        Py_ssize_t j = 0;
+        for (Py_ssize_t i = 0; j < numentries; i++) {
+            if (oldvalues[i] == NULL) {
+                continue;
+            }
             PyDictKeyEntry *ep = &oldentries[i];
             PyObject *key = ep->me_key;
             Py_INCREF(key);
-            newentries[i].me_key = key;
-            newentries[i].me_hash = ep->me_hash;
-            newentries[i].me_value = oldvalues[i];
+            newentries[j].me_key = key;
+            newentries[j].me_hash = ep->me_hash;
+            newentries[j].me_value = oldvalues[i];
+            j++;
         }
 
         dictkeys_decref(oldkeys);
@@ -1299,6 +1310,44 @@ _PyDict_NewPresized(Py_ssize_t minused)
     return new_dict(new_keys, NULL);
 }
 
+/* Makes room for n items in the empty dict mp, so that inserting them does
+   not resize it over and over.  Split tables are left alone, so that they
+   keep sharing their keys.  Returns -1 on error. */
+static int
+dict_presize(PyDictObject *mp, Py_ssize_t n)
+{
+    assert(mp->ma_used == 0);
+    if (mp->ma_values != NULL && mp->ma_values != empty_values) {
+        return 0;
+    }
+    if (n <= mp->ma_keys->dk_usable) {
+        return 0;
+    }
+    /* Don't overflow the size of the keys object */
+    if (n > PY_SSIZE_T_MAX / (Py_ssize_t)(2 * sizeof(PyDictKeyEntry))) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return dictresize(mp, estimate_log2_keysize(n));
+}
+
+/* Called once the items have been inserted into a dict sized by
+   dict_presize().  The length hint counts items, not distinct keys, so the
+   table can be far too large: dict([(0, 0)] * 1000000) has one item.
+   Shrink it if it is more than twice the size needed for its items.
+   Returns -1 on error. */
+static int
+dict_trim_presized(PyDictObject *mp)
+{
+    uint8_t log2_newsize = estimate_log2_keysize(mp->ma_used);
+    if (mp->ma_values != NULL ||
+        DK_LOG_SIZE(mp->ma_keys) <= log2_newsize + 1)
+    {
+        return 0;
+    }
+    return dictresize(mp, log2_newsize);
+}
+
 /* Note that, for historical reasons, PyDict_GetItem() suppresses all errors
  * that may occur (originally dicts supported only string keys, and exceptions
  * weren't possible).  So, while the original intent was that a NULL return
@@ -1738,12 +1787,16 @@ _PyDict_Next(PyObject *op, Py_ssize_t *ppos, PyObject **pkey,
     mp = (PyDictObject *)op;
     i = *ppos;
     if (mp->ma_values) {
-        if (i < 0 || i >= mp->ma_used)
+        Py_ssize_t n = mp->ma_keys->dk_nentries;
+        if (i < 0 || i >= n)
+            return 0;
+        while (i < n && mp->ma_values[i] == NULL) {
+            i++;
+        }
+        if (i >= n)
             return 0;
-        /* values of split table is always dense */
         entry_ptr = &DK_ENTRIES(mp->ma_keys)[i];
         value = mp->ma_values[i];
-        assert(value != NULL);
     }
     else {
         Py_ssize_t n = mp->ma_keys->dk_nentries;
@@ -2306,6 +2359,129 @@ dict_fromkeys_impl(PyTypeObject *type, PyObject *iterable, PyObject *value)
     return _PyDict_FromKeys((PyObject *)type, iterable, value);
 }
 
+/*[clinic input]
+@classmethod
+dict.from_pairs
+    keys: object
+    values: object
+    /
+
+Create a new dictionary mapping the items of keys to the items of values.
+
+keys and values are iterables of the same length: each item of keys is
+mapped to the item of values at the same position.
+[clinic start generated code]*/
+
+static PyObject *
+dict_from_pairs_impl(PyTypeObject *type, PyObject *keys, PyObject *values)
+/*[clinic end generated code: output=82d55e693d3dae31 input=4eb3f5440061d663]*/
+{
+    PyObject *d, *keys_it = NULL, *values_it = NULL;
+    PyObject *key, *value;
+    int status;
+
+    d = _PyObject_CallNoArg((PyObject *)type);
+    if (d == NULL) {
+        return NULL;
+    }
+    int exact = PyDict_CheckExact(d);
+    int presized = exact && ((PyDictObject *)d)->ma_used == 0;
+    if (presized) {
+        Py_ssize_t n = PyObject_LengthHint(keys, 0);
+        if (n < 0 || dict_presize((PyDictObject *)d, n) < 0) {
+            goto Fail;
+        }
+    }
+
+    keys_it = PyObject_GetIter(keys);
+    if (keys_it == NULL) {
+        goto Fail;
+    }
+    values_it = PyObject_GetIter(values);
+    if (values_it == NULL) {
+        goto Fail;
+    }
+    while ((key = PyIter_Next(keys_it)) != NULL) {
+        value = PyIter_Next(values_it);
+        if (value == NULL) {
+            Py_DECREF(key);
+            if (!PyErr_Occurred()) {
+                PyErr_SetString(PyExc_ValueError,
+                                "dict.from_pairs(): values is shorter than keys");
+            }
+            goto Fail;
+        }
+        if (exact) {
+            status = PyDict_SetItem(d, key, value);
+        }
+        else {
+            status = PyObject_SetItem(d, key, value);
+        }
+        Py_DECREF(key);
+        Py_DECREF(value);
+        if (status < 0) {
+            goto Fail;
+        }
+    }
+    if (PyErr_Occurred()) {
+        goto Fail;
+    }
+    value = PyIter_Next(values_it);
+    if (value != NULL) {
+        Py_DECREF(value);
+        PyErr_SetString(PyExc_ValueError,
+                        "dict.from_pairs(): values is longer than keys");
+        goto Fail;
+    }
+    if (PyErr_Occurred()) {
+        goto Fail;
+    }
+    if (presized && dict_trim_presized((PyDictObject *)d) < 0) {
+        goto Fail;
+    }
+    Py_DECREF(keys_it);
+    Py_DECREF(values_it);
+    return d;
+
+Fail:
+    Py_XDECREF(keys_it);
+    Py_XDECREF(values_it);
+    Py_DECREF(d);
+    return NULL;
+}
+
+/*[clinic input]
+@classmethod
+dict.with_capacity
+    n: Py_ssize_t
+    /
+
+Create a new empty dictionary with room for n items.
+
+Inserting up to n items into the dictionary does not resize it.
+[clinic start generated code]*/
+
+static PyObject *
+dict_with_capacity_impl(PyTypeObject *type, Py_ssize_t n)
+/*[clinic end generated code: output=fc1ca75f288217bf input=fb53073d04dd44b1]*/
+{
+    if (n < 0) {
+        PyErr_SetString(PyExc_ValueError, "n must be non-negative");
+        return NULL;
+    }
+    PyObject *d = _PyObject_CallNoArg((PyObject *)type);
+    if (d == NULL) {
+        return NULL;
+    }
+    if (PyDict_Check(d) && ((PyDictObject *)d)->ma_used == 0 &&
+        dict_presize((PyDictObject *)d, n) < 0)
+    {
+        Py_DECREF(d);
+        return NULL;
+    }
+    return d;
+}
+
 /* Single-arg dict update; used by dict_update_common and operators. */
 static int
 dict_update_arg(PyObject *self, PyObject *arg)
@@ -2381,6 +2557,14 @@ PyDict_MergeFromSeq2(PyObject *d, PyObject *seq2, int override)
     assert(PyDict_Check(d));
     assert(seq2 != NULL);
 
+    int presized = PyDict_CheckExact(d) && ((PyDictObject *)d)->ma_used == 0;
+    if (presized) {
+        Py_ssize_t n = PyObject_LengthHint(seq2, 0);
+        if (n < 0 || dict_presize((PyDictObject *)d, n) < 0) {
+            return -1;
+        }
+    }
+
     it = PyObject_GetIter(seq2);
     if (it == NULL)
         return -1;
@@ -2442,6 +2626,9 @@ PyDict_MergeFromSeq2(PyObject *d, PyObject *seq2, int override)
         Py_DECREF(item);
     }
 
+    if (presized && dict_trim_presized((PyDictObject *)d) < 0) {
+        goto Fail;
+    }
     i = 0;
     ASSERT_CONSISTENT(d);
     goto Return;
@@ -2962,9 +3149,8 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
     if (ix == DKIX_ERROR)
         return NULL;
 
-    if (_PyDict_HasSplitTable(mp) &&
-        ((ix >= 0 && value == NULL && mp->ma_used != ix) ||
-         (ix == DKIX_EMPTY && mp->ma_used != mp->ma_keys->dk_nentries))) {
+    if (_PyDict_HasSplitTable(mp) && ix >= 0 && value == NULL &&
+        (mp->ma_used != ix || !_PyDict_SplitSlotInOrder(mp, ix))) {
         if (insertion_resize(mp) < 0) {
             return NULL;
         }
@@ -3289,6 +3475,8 @@ static PyMethodDef mapp_methods[] = {
     {"update",          (PyCFunction)(void(*)(void))dict_update, METH_VARARGS | METH_KEYWORDS,
      update__doc__},
     DICT_FROMKEYS_METHODDEF
+    DICT_FROM_PAIRS_METHODDEF
+    DICT_WITH_CAPACITY_METHODDEF
     {"clear",           (PyCFunction)dict_clear,        METH_NOARGS,
      clear__doc__},
     {"copy",            (PyCFunction)dict_copy,         METH_NOARGS,
@@ -3584,12 +3772,7 @@ dictiter_new(PyDictObject *dict, PyTypeObject *itertype)
     if (itertype == &PyDictRevIterKey_Type ||
          itertype == &PyDictRevIterItem_Type ||
          itertype == &PyDictRevIterValue_Type) {
-        if (dict->ma_values) {
-            di->di_pos = dict->ma_used - 1;
-        }
-        else {
-            di->di_pos = dict->ma_keys->dk_nentries - 1;
-        }
+        di->di_pos = dict->ma_keys->dk_nentries - 1;
     }
     else {
         di->di_pos = 0;
@@ -3675,10 +3858,13 @@ dictiter_iternextkey(dictiterobject *di)
     k = d->ma_keys;
     assert(i >= 0);
     if (d->ma_values) {
-        if (i >= d->ma_used)
+        Py_ssize_t n = k->dk_nentries;
+        while (i < n && d->ma_values[i] == NULL) {
+            i++;
+        }
+        if (i >= n)
             goto fail;
         key = DK_ENTRIES(k)[i].me_key;
-        assert(d->ma_values[i] != NULL);
     }
     else {
         Py_ssize_t n = k->dk_nentries;
@@ -3762,10 +3948,13 @@ dictiter_iternextvalue(dictiterobject *di)
     i = di->di_pos;
     assert(i >= 0);
     if (d->ma_values) {
-        if (i >= d->ma_used)
+        Py_ssize_t n = d->ma_keys->dk_nentries;
+        while (i < n && d->ma_values[i] == NULL) {
+            i++;
+        }
+        if (i >= n)
             goto fail;
         value = d->ma_values[i];
-        assert(value != NULL);
     }
     else {
         Py_ssize_t n = d->ma_keys->dk_nentries;
@@ -3849,11 +4038,14 @@ dictiter_iternextitem(dictiterobject *di)
     i = di->di_pos;
     assert(i >= 0);
     if (d->ma_values) {
-        if (i >= d->ma_used)
+        Py_ssize_t n = d->ma_keys->dk_nentries;
+        while (i < n && d->ma_values[i] == NULL) {
+            i++;
+        }
+        if (i >= n)
             goto fail;
         key = DK_ENTRIES(d->ma_keys)[i].me_key;
         value = d->ma_values[i];
-        assert(value != NULL);
     }
     else {
         Py_ssize_t n = d->ma_keys->dk_nentries;
@@ -3968,9 +4160,13 @@ dictreviter_iternext(dictiterobject *di)
         goto fail;
     }
     if (d->ma_values) {
+        while (d->ma_values[i] == NULL) {
+            if (--i < 0) {
+                goto fail;
+            }
+        }
         key = DK_ENTRIES(k)[i].me_key;
         value = d->ma_values[i];
-        assert (value != NULL);
     }
     else {
         PyDictKeyEntry *entry_ptr = &DK_ENTRIES(k)[i];
@@ -4955,6 +5151,55 @@ PyObject_GenericGetDict(PyObject *obj, void *context)
     return dict;
 }
 
+/* Set or delete (if value is NULL) the attribute key in the split table
+   mp of an instance.  Unlike the dict API, deleting leaves a pending entry,
+   and a pending entry can be set whenever that keeps insertion order, so
+   that instances which set attributes conditionally or delete them keep
+   sharing the keys of their class.  Setting out of order combines only
+   this dict.  Return 1 if done, 0 if the dict API must be used, or -1 on
+   error. */
+static int
+split_table_setattr(PyDictObject *mp, PyObject *key, PyObject *value)
+{
+    Py_hash_t hash;
+    PyObject *old_value;
+
+    assert(_PyDict_HasSplitTable(mp) && PyUnicode_CheckExact(key));
+    if ((hash = ((PyASCIIObject *) key)->hash) == -1) {
+        hash = PyObject_Hash(key);
+        if (hash == -1)
+            return -1;
+    }
+    Py_ssize_t ix = _Py_dict_lookup(mp, key, hash, &old_value);
+    if (ix == DKIX_ERROR)
+        return -1;
+    if (ix == DKIX_EMPTY || (old_value == NULL) == (value == NULL)) {
+        /* New keys, replaced values and missing keys are left to the dict
+           API. */
+        return 0;
+    }
+    if (value == NULL) {
+        mp->ma_values[ix] = NULL;
+        mp->ma_used--;
+        mp->ma_version_tag = DICT_NEXT_VERSION();
+        Py_DECREF(old_value);
+        ASSERT_CONSISTENT(mp);
+        return 1;
+    }
+    if (!_PyDict_SplitSlotInOrder(mp, ix)) {
+        if (dictresize(mp, DK_LOG_SIZE(mp->ma_keys)) < 0)
+            return -1;
+        return insertdict(mp, key, hash, value) < 0 ? -1 : 1;
+    }
+    Py_INCREF(value);
+    MAINTAIN_TRACKING(mp, key, value);
+    mp->ma_values[ix] = value;
+    mp->ma_used++;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
+    ASSERT_CONSISTENT(mp);
+    return 1;
+}
+
 int
 _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
                       PyObject *key, PyObject *value)
@@ -4974,14 +5219,15 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
                 return -1;
             *dictptr = dict;
         }
+        if (((PyDictObject *)dict)->ma_keys == cached &&
+                PyUnicode_CheckExact(key)) {
+            res = split_table_setattr((PyDictObject *)dict, key, value);
+            if (res != 0) {
+                return res < 0 ? -1 : 0;
+            }
+        }
         if (value == NULL) {
             res = PyDict_DelItem(dict, key);
-            // Since key sharing dict doesn't allow deletion, PyDict_DelItem()
-            // always converts dict to combined form.
-            if ((cached = CACHED_KEYS(tp)) != NULL) {
-                CACHED_KEYS(tp) = NULL;
-                dictkeys_decref(cached);
-            }
         }
         else {
             int was_shared = (cached == ((PyDictObject *)dict)->ma_keys);
@@ -1153,6 +1153,10 @@ sortslice_advance(sortslice *slice, Py_ssize_t n)
 /* Avoid malloc for small temp arrays. */
 #define MERGESTATE_TEMP_SIZE 256
 
+/* Lists of floats or bounded ints at least this long are sorted by their
+ * unboxed values; see list_sort_impl(). */
+#define MIN_UNBOXED_SORT 64
+
 /* One MergeState exists on the stack per invocation of mergesort.  It's just
  * a convenient way to pass state around among the helper functions.
  */
@@ -1357,7 +1361,8 @@ gallop_left(MergeState *ms, PyObject *key, PyObject **a, Py_ssize_t n, Py_ssize_
     Py_ssize_t lastofs;
     Py_ssize_t k;
 
-    assert(key && a && n > 0 && hint >= 0 && hint < n);
+    /* key is NULL for an unboxed zero */
+    assert(a && n > 0 && hint >= 0 && hint < n);
 
     a += hint;
     lastofs = 0;
@@ -1446,7 +1451,8 @@ gallop_right(MergeState *ms, PyObject *key, PyObject **a, Py_ssize_t n, Py_ssize
     Py_ssize_t lastofs;
     Py_ssize_t k;
 
-    assert(key && a && n > 0 && hint >= 0 && hint < n);
+    /* key is NULL for an unboxed zero */
+    assert(a && n > 0 && hint >= 0 && hint < n);
 
     a += hint;
     lastofs = 0;
@@ -2173,6 +2179,29 @@ unsafe_float_compare(PyObject *v, PyObject *w, MergeState *ms)
     return res;
 }
 
+/* Unboxed compares: the pre-sort check may replace floats and bounded ints
+ * by their values, stored in the keys array in place of the pointers, so
+ * that compares don't have to load one object per key. */
+#if SIZEOF_DOUBLE <= SIZEOF_VOID_P
+static int
+unboxed_float_compare(PyObject *v, PyObject *w, MergeState *ms)
+{
+    double vd, wd;
+    memcpy(&vd, &v, sizeof(double));
+    memcpy(&wd, &w, sizeof(double));
+    return vd < wd;
+}
+#endif
+
+static int
+unboxed_long_compare(PyObject *v, PyObject *w, MergeState *ms)
+{
+    Py_ssize_t vi, wi;
+    memcpy(&vi, &v, sizeof(Py_ssize_t));
+    memcpy(&wi, &w, sizeof(Py_ssize_t));
+    return vi < wi;
+}
+
 /* Tuple compare: compare *any* two tuples, using
  * ms->tuple_elem_compare to compare the first elements, which is set
  * using the same pre-sort check as we use for ms->key_compare,
@@ -2252,6 +2281,7 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
     PyObject *result = NULL;            /* guilty until proved innocent */
     Py_ssize_t i;
     PyObject **keys;
+    int keys_are_unboxed = 0;
 
     assert(self != NULL);
     assert(PyList_Check(self));
@@ -2400,6 +2430,44 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
     }
     /* End of pre-sort check: ms is now set properly! */
 
+    /* Sort long lists of floats or bounded ints by their unboxed values, so
+     * that compares only touch the keys array.  The values array then holds
+     * the objects, as when a key function is used. */
+    if (keys == NULL && saved_ob_size >= MIN_UNBOXED_SORT &&
+        (ms.key_compare == unsafe_long_compare
+#if SIZEOF_DOUBLE <= SIZEOF_VOID_P
+         || ms.key_compare == unsafe_float_compare
+#endif
+        ))
+    {
+        if (saved_ob_size < MERGESTATE_TEMP_SIZE/2)
+            keys = &ms.temparray[saved_ob_size+1];
+        else
+            keys = PyMem_Malloc(sizeof(PyObject *) * saved_ob_size);
+        /* If there is no memory for the keys, sort the objects */
+        if (keys != NULL) {
+            if (ms.key_compare == unsafe_long_compare) {
+                for (i = 0; i < saved_ob_size; i++) {
+                    PyLongObject *v = (PyLongObject *)saved_ob_item[i];
+                    Py_ssize_t value = Py_SIZE(v) * (Py_ssize_t)(
+                        Py_SIZE(v) == 0 ? 0 : v->ob_digit[0]);
+                    memcpy(&keys[i], &value, sizeof(Py_ssize_t));
+                }
+                ms.key_compare = unboxed_long_compare;
+            }
+            else {
+                for (i = 0; i < saved_ob_size; i++) {
+                    double value = PyFloat_AS_DOUBLE(saved_ob_item[i]);
+                    memcpy(&keys[i], &value, sizeof(double));
+                }
+                ms.key_compare = unboxed_float_compare;
+            }
+            keys_are_unboxed = 1;
+            lo.keys = keys;
+            lo.values = saved_ob_item;
+        }
+    }
+
     merge_init(&ms, saved_ob_size, keys != NULL, &lo);
 
     nremaining = saved_ob_size;
@@ -2464,8 +2532,10 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
     result = Py_None;
 fail:
     if (keys != NULL) {
-        for (i = 0; i < saved_ob_size; i++)
-            Py_DECREF(keys[i]);
+        if (!keys_are_unboxed) {
+            for (i = 0; i < saved_ob_size; i++)
+                Py_DECREF(keys[i]);
+        }
         if (saved_ob_size >= MERGESTATE_TEMP_SIZE/2)
             PyMem_Free(keys);
     }
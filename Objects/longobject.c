@@ -76,6 +76,14 @@ maybe_small_long(PyLongObject *v)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* Larger products use Toom-3 once both operands have at least TOOM3_CUTOFF
+ * digits, and a number-theoretic transform once the smaller one has at least
+ * NTT_CUTOFF digits (NTT_SQUARE_CUTOFF for squares).  See k_mul().
+ */
+#define TOOM3_CUTOFF 250
+#define NTT_CUTOFF 2500
+#define NTT_SQUARE_CUTOFF 2500
+
 /* For exponentiation, use the binary left-to-right algorithm
  * unless the exponent contains more than FIVEARY_CUTOFF digits.
  * In that case, do 5 bits at a time.  The potential drawback is that
@@ -83,6 +91,33 @@ maybe_small_long(PyLongObject *v)
  */
 #define FIVEARY_CUTOFF 8
 
+/* Modular exponentiation with an odd modulus of at most MONTGOMERY_CUTOFF
+ * digits works on digit arrays in Montgomery form, scanning the exponent
+ * with a sliding window instead.  See long_pow_montgomery().
+ */
+#define MONTGOMERY_CUTOFF 500
+
+/* Conversions between ints and decimal strings switch from the quadratic
+ * algorithms to divide-and-conquer ones for ints of more than
+ * TO_DECIMAL_DC_CUTOFF digits and strings of more than FROM_DECIMAL_DC_CUTOFF
+ * characters.  The recursion stops at DECIMAL_DC_BASE base
+ * _PyLong_DECIMAL_BASE digits (a power of 2), and reciprocals of up to
+ * INVERT_CUTOFF bits are computed by long division instead of Newton's
+ * method.
+ */
+#define TO_DECIMAL_DC_CUTOFF 2500
+#define FROM_DECIMAL_DC_CUTOFF 4000
+#define DECIMAL_DC_BASE 256
+#define INVERT_CUTOFF (4 * KARATSUBA_CUTOFF * PyLong_SHIFT)
+
+/* For int division, use the O(N**2) school algorithm unless both the divisor
+ * and the quotient have at least BURNIKEL_ZIEGLER_CUTOFF digits.  The
+ * recursion of x_divrem_bz() then stops at quotients of at most
+ * BURNIKEL_ZIEGLER_BASE bits.
+ */
+#define BURNIKEL_ZIEGLER_CUTOFF 200
+#define BURNIKEL_ZIEGLER_BASE (BURNIKEL_ZIEGLER_CUTOFF * PyLong_SHIFT / 2)
+
 #define SIGCHECK(PyTryBlock)                    \
     do {                                        \
         if (PyErr_CheckSignals()) PyTryBlock    \
@@ -1633,6 +1668,373 @@ divrem1(PyLongObject *a, digit n, digit *prem)
     return long_normalize(z);
 }
 
+/* Convert the absolute value of an integer to base _PyLong_DECIMAL_BASE
+   digits, stored least significant first in pout.  Return their number (0
+   for a == 0), or -1 if interrupted. */
+
+static Py_ssize_t
+long_to_decimal_digits(PyLongObject *a, digit *pout)
+{
+    Py_ssize_t size, size_a, i, j;
+    digit *pin;
+
+    /* convert array of base _PyLong_BASE digits in pin to an array of
+       base _PyLong_DECIMAL_BASE digits in pout, following Knuth (TAOCP,
+       Volume 2 (3rd edn), section 4.4, Method 1b). */
+    size_a = Py_ABS(Py_SIZE(a));
+    pin = a->ob_digit;
+    size = 0;
+    for (i = size_a; --i >= 0; ) {
+        digit hi = pin[i];
+        for (j = 0; j < size; j++) {
+            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
+            hi = (digit)(z / _PyLong_DECIMAL_BASE);
+            pout[j] = (digit)(z - (twodigits)hi *
+                              _PyLong_DECIMAL_BASE);
+        }
+        while (hi) {
+            pout[size++] = hi % _PyLong_DECIMAL_BASE;
+            hi /= _PyLong_DECIMAL_BASE;
+        }
+        /* check for keyboard interrupt */
+        SIGCHECK({
+                return -1;
+            });
+    }
+    return size;
+}
+
+/* Subquadratic conversions between ints and decimal strings.
+
+   Large values are split in two on the powers
+
+       P[i] = _PyLong_DECIMAL_BASE ** (2 ** i)
+
+   To convert 0 <= a < P[i+1] to decimal, divide it by P[i]: the quotient
+   and the remainder then each give 2 ** i base _PyLong_DECIMAL_BASE digits.
+   To parse a string, parse its two halves and join them with one
+   multiplication by P[i].  Products are computed by k_mul(), and divisions
+   by P[i] are replaced by multiplications by its reciprocal, computed once
+   per level by Newton's method.  Both directions thus take O(M(n) log n)
+   time, where M(n) is the cost of multiplying two n-digit ints.
+*/
+
+/* forward */
+static PyObject *long_add(PyLongObject *, PyLongObject *);
+static PyObject *long_sub(PyLongObject *, PyLongObject *);
+static PyObject *long_mul(PyLongObject *, PyLongObject *);
+static int long_divrem(PyLongObject *, PyLongObject *,
+                       PyLongObject **, PyLongObject **);
+static Py_ssize_t long_compare(PyLongObject *, PyLongObject *);
+
+/* More than enough for P[i] to exceed the largest int */
+#define MAX_DECIMAL_POWERS 64
+
+typedef struct {
+    int size;                                 /* number of P[i] computed */
+    PyLongObject *pow[MAX_DECIMAL_POWERS];    /* P[i] */
+    PyLongObject *inv[MAX_DECIMAL_POWERS];    /* its reciprocal, or NULL */
+    size_t bits[MAX_DECIMAL_POWERS];          /* its bit length */
+} decimal_powers;
+
+static void
+decimal_powers_clear(decimal_powers *p)
+{
+    int i;
+    for (i = 0; i < p->size; i++) {
+        Py_DECREF(p->pow[i]);
+        Py_XDECREF(p->inv[i]);
+    }
+    p->size = 0;
+}
+
+/* Compute P[0] to P[i] if not done yet.  Return -1 on error. */
+static int
+decimal_powers_extend(decimal_powers *p, int i)
+{
+    assert(i < MAX_DECIMAL_POWERS);
+    while (p->size <= i) {
+        PyLongObject *z;
+        if (p->size == 0) {
+            z = (PyLongObject *)PyLong_FromLong(_PyLong_DECIMAL_BASE);
+        }
+        else {
+            PyLongObject *prev = p->pow[p->size - 1];
+            z = (PyLongObject *)long_mul(prev, prev);
+        }
+        if (z == NULL) {
+            return -1;
+        }
+        p->pow[p->size] = z;
+        p->inv[p->size] = NULL;
+        p->bits[p->size] = _PyLong_NumBits((PyObject *)z);
+        p->size++;
+    }
+    return 0;
+}
+
+/* Return an approximation of 2 ** (2*n) / d, off by a few units at most, for
+   an int d > 0 of n bits.  It is computed recursively from the top half of d
+   and refined with one Newton step, x += x * (2**(2*n) - d*x) / 2**(2*n). */
+static PyLongObject *
+long_reciprocal(PyLongObject *d, size_t n)
+{
+    PyLongObject *pow2, *x = NULL, *e = NULL, *t = NULL, *u;
+    PyObject *one = _PyLong_GetOne();
+
+    pow2 = (PyLongObject *)_PyLong_Lshift(one, 2 * n);
+    if (pow2 == NULL) {
+        return NULL;
+    }
+    if (n <= INVERT_CUTOFF) {
+        if (long_divrem(pow2, d, &x, &e) < 0) {
+            goto Error;
+        }
+        Py_DECREF(e);
+        Py_DECREF(pow2);
+        return x;
+    }
+
+    /* x ~= 2**(2*n) / d from the reciprocal of d >> k */
+    size_t k = n / 2 - 2;
+    t = (PyLongObject *)_PyLong_Rshift((PyObject *)d, k);
+    if (t == NULL) {
+        goto Error;
+    }
+    u = long_reciprocal(t, n - k);
+    Py_SETREF(t, NULL);
+    if (u == NULL) {
+        goto Error;
+    }
+    x = (PyLongObject *)_PyLong_Lshift((PyObject *)u, k);
+    Py_DECREF(u);
+    if (x == NULL) {
+        goto Error;
+    }
+
+    /* Newton step */
+    t = (PyLongObject *)long_mul(d, x);
+    if (t == NULL) {
+        goto Error;
+    }
+    e = (PyLongObject *)long_sub(pow2, t);
+    Py_SETREF(t, NULL);
+    if (e == NULL) {
+        goto Error;
+    }
+    t = (PyLongObject *)long_mul(x, e);
+    Py_SETREF(e, NULL);
+    if (t == NULL) {
+        goto Error;
+    }
+    u = (PyLongObject *)_PyLong_Rshift((PyObject *)t, 2 * n);
+    Py_SETREF(t, NULL);
+    if (u == NULL) {
+        goto Error;
+    }
+    Py_SETREF(x, (PyLongObject *)long_add(x, u));
+    Py_DECREF(u);
+    if (x == NULL) {
+        goto Error;
+    }
+    Py_DECREF(pow2);
+    return x;
+
+  Error:
+    Py_XDECREF(x);
+    Py_XDECREF(e);
+    Py_DECREF(pow2);
+    return NULL;
+}
+
+/* Divide 0 <= a < P[i]**2 by P[i], storing the quotient and remainder in
+   *pq and *pr.  The quotient is estimated from the top n+1 bits of a and the
+   reciprocal of P[i], n being its bit length, and then corrected by a few
+   units.  Return -1 on error. */
+static int
+decimal_powers_divmod(decimal_powers *p, int i, PyLongObject *a,
+                      PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *d = p->pow[i], *q, *r = NULL, *t;
+    PyObject *one = _PyLong_GetOne();
+    size_t n = p->bits[i];
+
+    if (p->inv[i] == NULL) {
+        p->inv[i] = long_reciprocal(d, n);
+        if (p->inv[i] == NULL) {
+            return -1;
+        }
+    }
+    q = (PyLongObject *)_PyLong_Rshift((PyObject *)a, n - 1);
+    if (q == NULL) {
+        return -1;
+    }
+    t = (PyLongObject *)long_mul(q, p->inv[i]);
+    Py_DECREF(q);
+    if (t == NULL) {
+        return -1;
+    }
+    q = (PyLongObject *)_PyLong_Rshift((PyObject *)t, n + 1);
+    Py_DECREF(t);
+    if (q == NULL) {
+        return -1;
+    }
+    t = (PyLongObject *)long_mul(q, d);
+    if (t == NULL) {
+        goto Error;
+    }
+    r = (PyLongObject *)long_sub(a, t);
+    Py_DECREF(t);
+    if (r == NULL) {
+        goto Error;
+    }
+    while (Py_SIZE(r) < 0) {
+        Py_SETREF(r, (PyLongObject *)long_add(r, d));
+        if (r == NULL) {
+            goto Error;
+        }
+        Py_SETREF(q, (PyLongObject *)long_sub(q, (PyLongObject *)one));
+        if (q == NULL) {
+            goto Error;
+        }
+    }
+    while (long_compare(r, d) >= 0) {
+        Py_SETREF(r, (PyLongObject *)long_sub(r, d));
+        if (r == NULL) {
+            goto Error;
+        }
+        Py_SETREF(q, (PyLongObject *)long_add(q, (PyLongObject *)one));
+        if (q == NULL) {
+            goto Error;
+        }
+    }
+    *pq = q;
+    *pr = r;
+    return 0;
+
+  Error:
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    return -1;
+}
+
+/* Store the 2 ** (i+1) base _PyLong_DECIMAL_BASE digits of 0 <= a < P[i+1]
+   in pout, least significant first and padded with zeros.  Return -1 on
+   error. */
+static int
+long_to_decimal_digits_dc(PyLongObject *a, decimal_powers *p, int i,
+                          digit *pout)
+{
+    Py_ssize_t half = (Py_ssize_t)1 << i;
+    PyLongObject *q, *r;
+    int res;
+
+    if (2 * half <= DECIMAL_DC_BASE) {
+        Py_ssize_t size = long_to_decimal_digits(a, pout);
+        if (size < 0) {
+            return -1;
+        }
+        assert(size <= 2 * half);
+        memset(pout + size, 0, (2 * half - size) * sizeof(digit));
+        return 0;
+    }
+    if (decimal_powers_divmod(p, i, a, &q, &r) < 0) {
+        return -1;
+    }
+    res = long_to_decimal_digits_dc(r, p, i - 1, pout);
+    Py_DECREF(r);
+    if (res == 0) {
+        res = long_to_decimal_digits_dc(q, p, i - 1, pout + half);
+    }
+    Py_DECREF(q);
+    return res;
+}
+
+/* Convert the n decimal digits at s to an int with the quadratic
+   algorithm. */
+static PyLongObject *
+long_from_decimal_digits(const char *s, Py_ssize_t n)
+{
+    const char *end = s + n;
+    PyLongObject *z;
+    int width;
+
+    /* each group of _PyLong_DECIMAL_SHIFT digits adds at most one digit */
+    z = _PyLong_New(n / _PyLong_DECIMAL_SHIFT + 1);
+    if (z == NULL) {
+        return NULL;
+    }
+    Py_SET_SIZE(z, 0);
+    width = n % _PyLong_DECIMAL_SHIFT;
+    if (width == 0) {
+        width = _PyLong_DECIMAL_SHIFT;
+    }
+    while (s < end) {
+        twodigits c = 0, convmult = 1;
+        digit *pz, *pzstop;
+
+        for (; width > 0; width--) {
+            c = c * 10 + (*s++ - '0');
+            convmult *= 10;
+        }
+        width = _PyLong_DECIMAL_SHIFT;
+
+        /* Multiply z by convmult, and add c. */
+        pz = z->ob_digit;
+        pzstop = pz + Py_SIZE(z);
+        for (; pz < pzstop; ++pz) {
+            c += (twodigits)*pz * convmult;
+            *pz = (digit)(c & PyLong_MASK);
+            c >>= PyLong_SHIFT;
+        }
+        if (c) {
+            assert(c < PyLong_BASE);
+            *pz = (digit)c;
+            Py_SET_SIZE(z, Py_SIZE(z) + 1);
+        }
+    }
+    return z;
+}
+
+/* Convert the n decimal digits at s to an int, splitting them on the
+   largest P[i] with fewer digits. */
+static PyLongObject *
+long_from_decimal_digits_dc(const char *s, Py_ssize_t n, decimal_powers *p)
+{
+    PyLongObject *hi, *lo, *t, *z;
+    Py_ssize_t lo_len = _PyLong_DECIMAL_SHIFT;
+    int i = 0;
+
+    if (n <= DECIMAL_DC_BASE * _PyLong_DECIMAL_SHIFT) {
+        return long_from_decimal_digits(s, n);
+    }
+    while (2 * lo_len < n) {
+        lo_len *= 2;
+        i++;
+    }
+    if (decimal_powers_extend(p, i) < 0) {
+        return NULL;
+    }
+    hi = long_from_decimal_digits_dc(s, n - lo_len, p);
+    if (hi == NULL) {
+        return NULL;
+    }
+    t = (PyLongObject *)long_mul(hi, p->pow[i]);
+    Py_DECREF(hi);
+    if (t == NULL) {
+        return NULL;
+    }
+    lo = long_from_decimal_digits_dc(s + n - lo_len, lo_len, p);
+    if (lo == NULL) {
+        Py_DECREF(t);
+        return NULL;
+    }
+    z = (PyLongObject *)long_add(t, lo);
+    Py_DECREF(t);
+    Py_DECREF(lo);
+    return z;
+}
+
 /* Convert an integer to a base 10 string.  Returns a new non-shared
    string.  (Return value is non-shared so that callers can modify the
    returned value if necessary.) */
@@ -1647,7 +2049,7 @@ long_to_decimal_string_internal(PyObject *aa,
     PyLongObject *scratch, *a;
     PyObject *str = NULL;
     Py_ssize_t size, strlen, size_a, i, j;
-    digit *pout, *pin, rem, tenpow;
+    digit *pout, rem, tenpow;
     int negative;
     int d;
     enum PyUnicode_Kind kind;
@@ -1678,33 +2080,66 @@ long_to_decimal_string_internal(PyObject *aa,
         (10 * PyLong_SHIFT - 33 * _PyLong_DECIMAL_SHIFT);
     assert(size_a < PY_SSIZE_T_MAX/2);
     size = 1 + size_a + size_a / d;
-    scratch = _PyLong_New(size);
-    if (scratch == NULL)
-        return -1;
 
-    /* convert array of base _PyLong_BASE digits in pin to an array of
-       base _PyLong_DECIMAL_BASE digits in pout, following Knuth (TAOCP,
-       Volume 2 (3rd edn), section 4.4, Method 1b). */
-    pin = a->ob_digit;
-    pout = scratch->ob_digit;
-    size = 0;
-    for (i = size_a; --i >= 0; ) {
-        digit hi = pin[i];
-        for (j = 0; j < size; j++) {
-            twodigits z = (twodigits)pout[j] << PyLong_SHIFT | hi;
-            hi = (digit)(z / _PyLong_DECIMAL_BASE);
-            pout[j] = (digit)(z - (twodigits)hi *
-                              _PyLong_DECIMAL_BASE);
+    if (size_a > TO_DECIMAL_DC_CUTOFF) {
+        decimal_powers p = {0};
+        PyLongObject *abs_a;
+        size_t nbits = _PyLong_NumBits(aa);
+        int level = 0, res;
+
+        /* find a level with abs(a) < P[level+1]: P[level+1] is at least
+           2 ** (2 * (bits - 1)), bits being the bit length of P[level] */
+        if (nbits == (size_t)-1 && PyErr_Occurred()) {
+            return -1;
         }
-        while (hi) {
-            pout[size++] = hi % _PyLong_DECIMAL_BASE;
-            hi /= _PyLong_DECIMAL_BASE;
+        if (decimal_powers_extend(&p, 0) < 0) {
+            return -1;
         }
-        /* check for keyboard interrupt */
-        SIGCHECK({
-                Py_DECREF(scratch);
+        while (nbits > 2 * p.bits[level] - 2) {
+            if (decimal_powers_extend(&p, ++level) < 0) {
+                decimal_powers_clear(&p);
                 return -1;
-            });
+            }
+        }
+        size = Py_MAX(size, (Py_ssize_t)2 << level);
+        scratch = _PyLong_New(size);
+        abs_a = negative ? (PyLongObject *)_PyLong_Copy(a) : a;
+        if (scratch == NULL || abs_a == NULL) {
+            decimal_powers_clear(&p);
+            Py_XDECREF(scratch);
+            if (negative) {
+                Py_XDECREF(abs_a);
+            }
+            return -1;
+        }
+        if (negative) {
+            Py_SET_SIZE(abs_a, size_a);
+        }
+        pout = scratch->ob_digit;
+        res = long_to_decimal_digits_dc(abs_a, &p, level, pout);
+        decimal_powers_clear(&p);
+        if (negative) {
+            Py_DECREF(abs_a);
+        }
+        if (res < 0) {
+            Py_DECREF(scratch);
+            return -1;
+        }
+        size = (Py_ssize_t)2 << level;
+        while (size > 0 && pout[size-1] == 0) {
+            size--;
+        }
+    }
+    else {
+        scratch = _PyLong_New(size);
+        if (scratch == NULL)
+            return -1;
+        pout = scratch->ob_digit;
+        size = long_to_decimal_digits(a, pout);
+        if (size < 0) {
+            Py_DECREF(scratch);
+            return -1;
+        }
     }
     /* pout should have at least one digit, so that the case when a = 0
        works correctly */
@@ -2242,7 +2677,8 @@ PyLong_FromString(const char *str, char **pend, int base)
 /***
 Binary bases can be converted in time linear in the number of digits, because
 Python's representation base is binary.  Other bases (including decimal!) use
-the simple quadratic-time algorithm below, complicated by some speed tricks.
+the simple quadratic-time algorithm below, complicated by some speed tricks,
+except for long decimal strings: see long_from_decimal_digits_dc().
 
 First some math:  the largest integer that can be expressed in N base-B digits
 is B**N-1.  Consequently, if we have an N-digit input in base B, the worst-
@@ -2395,82 +2831,114 @@ digit beyond the first.
                             "too many digits in integer");
             return NULL;
         }
-        size_z = (Py_ssize_t)fsize_z;
-        /* Uncomment next line to test exceedingly rare copy code */
-        /* size_z = 1; */
-        assert(size_z > 0);
-        z = _PyLong_New(size_z);
-        if (z == NULL) {
-            return NULL;
+        if (base == 10 && digits > FROM_DECIMAL_DC_CUTOFF) {
+            /* Subquadratic conversion; see long_from_decimal_digits_dc() */
+            decimal_powers p = {0};
+            char *buf = NULL;
+            const char *digstr = str;
+
+            if (scan - str != digits) {
+                /* remove the underscores */
+                const char *s;
+                Py_ssize_t k = 0;
+                buf = PyMem_Malloc(digits);
+                if (buf == NULL) {
+                    PyErr_NoMemory();
+                    return NULL;
+                }
+                for (s = str; s < scan; s++) {
+                    if (*s != '_') {
+                        buf[k++] = *s;
+                    }
+                }
+                digstr = buf;
+            }
+            z = long_from_decimal_digits_dc(digstr, digits, &p);
+            decimal_powers_clear(&p);
+            PyMem_Free(buf);
+            if (z == NULL) {
+                return NULL;
+            }
+            str = scan;
         }
-        Py_SET_SIZE(z, 0);
-
-        /* `convwidth` consecutive input digits are treated as a single
-         * digit in base `convmultmax`.
-         */
-        convwidth = convwidth_base[base];
-        convmultmax = convmultmax_base[base];
-
-        /* Work ;-) */
-        while (str < scan) {
-            if (*str == '_') {
-                str++;
-                continue;
+        else {
+            size_z = (Py_ssize_t)fsize_z;
+            /* Uncomment next line to test exceedingly rare copy code */
+            /* size_z = 1; */
+            assert(size_z > 0);
+            z = _PyLong_New(size_z);
+            if (z == NULL) {
+                return NULL;
             }
-            /* grab up to convwidth digits from the input string */
-            c = (digit)_PyLong_DigitValue[Py_CHARMASK(*str++)];
-            for (i = 1; i < convwidth && str != scan; ++str) {
+            Py_SET_SIZE(z, 0);
+
+            /* `convwidth` consecutive input digits are treated as a single
+             * digit in base `convmultmax`.
+             */
+            convwidth = convwidth_base[base];
+            convmultmax = convmultmax_base[base];
+
+            /* Work ;-) */
+            while (str < scan) {
                 if (*str == '_') {
+                    str++;
                     continue;
                 }
-                i++;
-                c = (twodigits)(c *  base +
-                                (int)_PyLong_DigitValue[Py_CHARMASK(*str)]);
-                assert(c < PyLong_BASE);
-            }
+                /* grab up to convwidth digits from the input string */
+                c = (digit)_PyLong_DigitValue[Py_CHARMASK(*str++)];
+                for (i = 1; i < convwidth && str != scan; ++str) {
+                    if (*str == '_') {
+                        continue;
+                    }
+                    i++;
+                    c = (twodigits)(c *  base +
+                        (int)_PyLong_DigitValue[Py_CHARMASK(*str)]);
+                    assert(c < PyLong_BASE);
+                }
 
-            convmult = convmultmax;
-            /* Calculate the shift only if we couldn't get
-             * convwidth digits.
-             */
-            if (i != convwidth) {
-                convmult = base;
-                for ( ; i > 1; --i) {
-                    convmult *= base;
+                convmult = convmultmax;
+                /* Calculate the shift only if we couldn't get
+                 * convwidth digits.
+                 */
+                if (i != convwidth) {
+                    convmult = base;
+                    for ( ; i > 1; --i) {
+                        convmult *= base;
+                    }
                 }
-            }
 
-            /* Multiply z by convmult, and add c. */
-            pz = z->ob_digit;
-            pzstop = pz + Py_SIZE(z);
-            for (; pz < pzstop; ++pz) {
-                c += (twodigits)*pz * convmult;
-                *pz = (digit)(c & PyLong_MASK);
-                c >>= PyLong_SHIFT;
-            }
-            /* carry off the current end? */
-            if (c) {
-                assert(c < PyLong_BASE);
-                if (Py_SIZE(z) < size_z) {
-                    *pz = (digit)c;
-                    Py_SET_SIZE(z, Py_SIZE(z) + 1);
+                /* Multiply z by convmult, and add c. */
+                pz = z->ob_digit;
+                pzstop = pz + Py_SIZE(z);
+                for (; pz < pzstop; ++pz) {
+                    c += (twodigits)*pz * convmult;
+                    *pz = (digit)(c & PyLong_MASK);
+                    c >>= PyLong_SHIFT;
                 }
-                else {
-                    PyLongObject *tmp;
-                    /* Extremely rare.  Get more space. */
-                    assert(Py_SIZE(z) == size_z);
-                    tmp = _PyLong_New(size_z + 1);
-                    if (tmp == NULL) {
+                /* carry off the current end? */
+                if (c) {
+                    assert(c < PyLong_BASE);
+                    if (Py_SIZE(z) < size_z) {
+                        *pz = (digit)c;
+                        Py_SET_SIZE(z, Py_SIZE(z) + 1);
+                    }
+                    else {
+                        PyLongObject *tmp;
+                        /* Extremely rare.  Get more space. */
+                        assert(Py_SIZE(z) == size_z);
+                        tmp = _PyLong_New(size_z + 1);
+                        if (tmp == NULL) {
+                            Py_DECREF(z);
+                            return NULL;
+                        }
+                        memcpy(tmp->ob_digit,
+                               z->ob_digit,
+                               sizeof(digit) * size_z);
                         Py_DECREF(z);
-                        return NULL;
+                        z = tmp;
+                        z->ob_digit[size_z] = (digit)c;
+                        ++size_z;
                     }
-                    memcpy(tmp->ob_digit,
-                           z->ob_digit,
-                           sizeof(digit) * size_z);
-                    Py_DECREF(z);
-                    z = tmp;
-                    z->ob_digit[size_z] = (digit)c;
-                    ++size_z;
                 }
             }
         }
@@ -2584,6 +3052,8 @@ PyLong_FromUnicodeObject(PyObject *u, int base)
 /* forward */
 static PyLongObject *x_divrem
     (PyLongObject *, PyLongObject *, PyLongObject **);
+static PyLongObject *x_divrem_bz
+    (PyLongObject *, PyLongObject *, PyLongObject **);
 static PyObject *long_long(PyObject *v);
 
 /* Int division with remainder, top-level routine */
@@ -2624,6 +3094,12 @@ long_divrem(PyLongObject *a, PyLongObject *b,
             return -1;
         }
     }
+    else if (size_b >= BURNIKEL_ZIEGLER_CUTOFF &&
+             size_a - size_b >= BURNIKEL_ZIEGLER_CUTOFF) {
+        z = x_divrem_bz(a, b, prem);
+        if (z == NULL)
+            return -1;
+    }
     else {
         z = x_divrem(a, b, prem);
         if (z == NULL)
@@ -2779,19 +3255,319 @@ x_divrem(PyLongObject *v1, PyLongObject *w1, PyLongObject **prem)
     return long_normalize(a);
 }
 
-/* For a nonzero PyLong a, express a in the form x * 2**e, with 0.5 <=
-   abs(x) < 1.0 and e >= 0; return x and put e in *e.  Here x is
-   rounded to DBL_MANT_DIG significant bits using round-half-to-even.
-   If a == 0, return 0.0 and set *e = 0.  If the resulting exponent
-   e is larger than PY_SSIZE_T_MAX, raise OverflowError and return
-   -1.0. */
-
-/* attempt to define 2.0**DBL_MANT_DIG as a compile-time constant */
-#if DBL_MANT_DIG == 53
-#define EXP2_DBL_MANT_DIG 9007199254740992.0
-#else
-#define EXP2_DBL_MANT_DIG (ldexp(1.0, DBL_MANT_DIG))
-#endif
+/* Recursive division, following Burnikel and Ziegler, "Fast Recursive
+   Division", MPI-I-98-1-022 (1998).  An n-bit divisor b is split into two
+   halves b1 and b2, and a 2n-bit dividend is divided in two steps, each
+   dividing 3 halves by 2 (long_div3n2n()).  Those estimate the quotient
+   from a division by b1 only, done recursively, and correct it with one
+   multiplication by b2.  Division thus costs O(M(n) log n), where M(n) is
+   the cost of a multiplication, instead of O(n**2). */
+
+/* Return (abs(a) >> start) % 2**nbits. */
+static PyLongObject *
+long_bit_slice(PyLongObject *a, size_t start, size_t nbits)
+{
+    Py_ssize_t size_a = Py_ABS(Py_SIZE(a)), size, i;
+    Py_ssize_t lo = (Py_ssize_t)(start / PyLong_SHIFT);
+    int shift = (int)(start % PyLong_SHIFT);
+    PyLongObject *z;
+
+    if (lo >= size_a) {
+        return (PyLongObject *)PyLong_FromLong(0);
+    }
+    size = Py_MIN(size_a - lo,
+                  (Py_ssize_t)((nbits + PyLong_SHIFT - 1) / PyLong_SHIFT));
+    z = _PyLong_New(size);
+    if (z == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < size; i++) {
+        twodigits x = a->ob_digit[lo + i] >> shift;
+        if (shift && lo + i + 1 < size_a) {
+            x |= (twodigits)a->ob_digit[lo + i + 1] << (PyLong_SHIFT - shift);
+        }
+        z->ob_digit[i] = (digit)(x & PyLong_MASK);
+    }
+    if ((size_t)size * PyLong_SHIFT > nbits) {
+        z->ob_digit[size - 1] &= ((digit)1 << (nbits % PyLong_SHIFT)) - 1;
+    }
+    return maybe_small_long(long_normalize(z));
+}
+
+/* Return (a << n) + c, for a, c >= 0. */
+static PyLongObject *
+long_shift_add(PyLongObject *a, size_t n, PyLongObject *c)
+{
+    PyLongObject *t, *z;
+
+    t = (PyLongObject *)_PyLong_Lshift((PyObject *)a, n);
+    if (t == NULL) {
+        return NULL;
+    }
+    z = (PyLongObject *)long_add(t, c);
+    Py_DECREF(t);
+    return z;
+}
+
+static int long_div3n2n(PyLongObject *, PyLongObject *, PyLongObject *,
+                        PyLongObject *, PyLongObject *, size_t,
+                        PyLongObject **, PyLongObject **);
+
+/* Divide 0 <= a < 2**n * b by b > 0 of exactly n bits. */
+static int
+long_div2n1n(PyLongObject *a, PyLongObject *b, size_t n,
+             PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *b1 = NULL, *b2 = NULL, *a12 = NULL, *a3 = NULL;
+    PyLongObject *q1 = NULL, *q2 = NULL, *r = NULL;
+    size_t half_n;
+    int pad = n & 1, res = -1;
+
+    if (_PyLong_NumBits((PyObject *)a) <= n + BURNIKEL_ZIEGLER_BASE) {
+        return long_divrem(a, b, pq, pr);
+    }
+    /* make n even */
+    if (pad) {
+        a = (PyLongObject *)_PyLong_Lshift((PyObject *)a, 1);
+        if (a == NULL) {
+            return -1;
+        }
+        b = (PyLongObject *)_PyLong_Lshift((PyObject *)b, 1);
+        if (b == NULL) {
+            Py_DECREF(a);
+            return -1;
+        }
+        n++;
+    }
+    half_n = n / 2;
+    if ((b1 = (PyLongObject *)_PyLong_Rshift((PyObject *)b, half_n)) == NULL ||
+        (b2 = long_bit_slice(b, 0, half_n)) == NULL ||
+        (a12 = (PyLongObject *)_PyLong_Rshift((PyObject *)a, n)) == NULL ||
+        (a3 = long_bit_slice(a, half_n, half_n)) == NULL) {
+        goto Done;
+    }
+    if (long_div3n2n(a12, a3, b, b1, b2, half_n, &q1, &r) < 0) {
+        goto Done;
+    }
+    Py_SETREF(a3, long_bit_slice(a, 0, half_n));
+    if (a3 == NULL) {
+        goto Done;
+    }
+    Py_SETREF(a12, r);
+    r = NULL;
+    if (long_div3n2n(a12, a3, b, b1, b2, half_n, &q2, &r) < 0) {
+        goto Done;
+    }
+    *pq = long_shift_add(q1, half_n, q2);
+    if (*pq == NULL) {
+        goto Done;
+    }
+    if (pad) {
+        *pr = (PyLongObject *)_PyLong_Rshift((PyObject *)r, 1);
+        if (*pr == NULL) {
+            Py_CLEAR(*pq);
+            goto Done;
+        }
+    }
+    else {
+        *pr = r;
+        r = NULL;
+    }
+    res = 0;
+
+  Done:
+    if (pad) {
+        Py_DECREF(a);
+        Py_DECREF(b);
+    }
+    Py_XDECREF(b1);
+    Py_XDECREF(b2);
+    Py_XDECREF(a12);
+    Py_XDECREF(a3);
+    Py_XDECREF(q1);
+    Py_XDECREF(q2);
+    Py_XDECREF(r);
+    return res;
+}
+
+/* Divide a12 * 2**n + a3 by b = b1 * 2**n + b2, b being of exactly 2*n bits
+   and the quotient less than 2**n. */
+static int
+long_div3n2n(PyLongObject *a12, PyLongObject *a3, PyLongObject *b,
+             PyLongObject *b1, PyLongObject *b2, size_t n,
+             PyLongObject **pq, PyLongObject **pr)
+{
+    PyLongObject *q = NULL, *r = NULL, *t;
+    PyObject *one = _PyLong_GetOne();
+
+    t = (PyLongObject *)_PyLong_Rshift((PyObject *)a12, n);
+    if (t == NULL) {
+        return -1;
+    }
+    if (long_compare(t, b1) == 0) {
+        /* q = 2**n - 1, r = a12 - b1 * 2**n + b1 */
+        Py_DECREF(t);
+        t = (PyLongObject *)_PyLong_Lshift(one, n);
+        if (t == NULL) {
+            return -1;
+        }
+        q = (PyLongObject *)long_sub(t, (PyLongObject *)one);
+        Py_DECREF(t);
+        if (q == NULL) {
+            return -1;
+        }
+        t = (PyLongObject *)_PyLong_Lshift((PyObject *)b1, n);
+        if (t == NULL) {
+            goto Error;
+        }
+        r = (PyLongObject *)long_sub(a12, t);
+        Py_DECREF(t);
+        if (r == NULL) {
+            goto Error;
+        }
+        Py_SETREF(r, (PyLongObject *)long_add(r, b1));
+        if (r == NULL) {
+            goto Error;
+        }
+    }
+    else {
+        Py_DECREF(t);
+        if (long_div2n1n(a12, b1, n, &q, &r) < 0) {
+            return -1;
+        }
+    }
+
+    /* r = r * 2**n + a3 - q * b2, corrected to 0 <= r < b */
+    Py_SETREF(r, long_shift_add(r, n, a3));
+    if (r == NULL) {
+        goto Error;
+    }
+    t = (PyLongObject *)long_mul(q, b2);
+    if (t == NULL) {
+        goto Error;
+    }
+    Py_SETREF(r, (PyLongObject *)long_sub(r, t));
+    Py_DECREF(t);
+    if (r == NULL) {
+        goto Error;
+    }
+    while (Py_SIZE(r) < 0) {
+        Py_SETREF(q, (PyLongObject *)long_sub(q, (PyLongObject *)one));
+        if (q == NULL) {
+            goto Error;
+        }
+        Py_SETREF(r, (PyLongObject *)long_add(r, b));
+        if (r == NULL) {
+            goto Error;
+        }
+    }
+    *pq = q;
+    *pr = r;
+    return 0;
+
+  Error:
+    Py_XDECREF(q);
+    Py_XDECREF(r);
+    return -1;
+}
+
+/* Unsigned int division with remainder by recursive division.  The dividend
+   is cut into n-bit pieces, n being the bit length of the divisor, which are
+   divided from the most significant one down by long_div2n1n(). */
+
+static PyLongObject *
+x_divrem_bz(PyLongObject *v, PyLongObject *w, PyLongObject **prem)
+{
+    PyLongObject *a = NULL, *b, *z = NULL, *r, *t, *q;
+    Py_ssize_t size_z;
+    size_t n, nbits, k;
+    int res;
+
+    /* work on the absolute values */
+    if (Py_SIZE(w) < 0) {
+        b = (PyLongObject *)_PyLong_Copy(w);
+        if (b == NULL) {
+            return NULL;
+        }
+        Py_SET_SIZE(b, -Py_SIZE(b));
+    }
+    else {
+        b = w;
+        Py_INCREF(b);
+    }
+    n = _PyLong_NumBits((PyObject *)b);
+    nbits = Py_ABS(Py_SIZE(v)) * PyLong_SHIFT;
+    k = (nbits + n - 1) / n;
+
+    size_z = (Py_ssize_t)((k * n + PyLong_SHIFT - 1) / PyLong_SHIFT);
+    z = _PyLong_New(size_z);
+    r = (PyLongObject *)PyLong_FromLong(0);
+    if (z == NULL || r == NULL) {
+        goto Error;
+    }
+    memset(z->ob_digit, 0, size_z * sizeof(digit));
+
+    while (k-- > 0) {
+        Py_ssize_t lo, i;
+        int shift;
+
+        a = long_bit_slice(v, k * n, n);
+        if (a == NULL) {
+            goto Error;
+        }
+        t = long_shift_add(r, n, a);
+        Py_CLEAR(a);
+        Py_CLEAR(r);
+        if (t == NULL) {
+            goto Error;
+        }
+        res = long_div2n1n(t, b, n, &q, &r);
+        Py_DECREF(t);
+        if (res < 0) {
+            goto Error;
+        }
+
+        /* the bits of z at k*n are still zero: add q there */
+        lo = (Py_ssize_t)(k * n / PyLong_SHIFT);
+        shift = (int)(k * n % PyLong_SHIFT);
+        for (i = 0; i < Py_SIZE(q); i++) {
+            twodigits x = (twodigits)q->ob_digit[i] << shift;
+            z->ob_digit[lo + i] |= (digit)(x & PyLong_MASK);
+            if (x >> PyLong_SHIFT) {
+                z->ob_digit[lo + i + 1] |= (digit)(x >> PyLong_SHIFT);
+            }
+        }
+        Py_DECREF(q);
+
+        SIGCHECK({
+                goto Error;
+            });
+    }
+    Py_DECREF(b);
+    *prem = r;
+    return long_normalize(z);
+
+  Error:
+    Py_XDECREF(a);
+    Py_XDECREF(r);
+    Py_XDECREF(z);
+    Py_DECREF(b);
+    return NULL;
+}
+
+/* For a nonzero PyLong a, express a in the form x * 2**e, with 0.5 <=
+   abs(x) < 1.0 and e >= 0; return x and put e in *e.  Here x is
+   rounded to DBL_MANT_DIG significant bits using round-half-to-even.
+   If a == 0, return 0.0 and set *e = 0.  If the resulting exponent
+   e is larger than PY_SSIZE_T_MAX, raise OverflowError and return
+   -1.0. */
+
+/* attempt to define 2.0**DBL_MANT_DIG as a compile-time constant */
+#if DBL_MANT_DIG == 53
+#define EXP2_DBL_MANT_DIG 9007199254740992.0
+#else
+#define EXP2_DBL_MANT_DIG (ldexp(1.0, DBL_MANT_DIG))
+#endif
 
 double
 _PyLong_Frexp(PyLongObject *a, Py_ssize_t *e)
@@ -3312,14 +4088,439 @@ kmul_split(PyLongObject *n,
     return 0;
 }
 
+static PyLongObject *k_mul(PyLongObject *a, PyLongObject *b);
 static PyLongObject *k_lopsided_mul(PyLongObject *a, PyLongObject *b);
 
+/* Toom-3 multiplication.  Ignores the input signs, and returns the absolute
+ * value of the product (or NULL if error).
+ *
+ * Both inputs are split in three pieces of k digits, which are viewed as the
+ * coefficients of polynomials in X = BASE**k:
+ *
+ *     a = a2*X**2 + a1*X + a0,  b = b2*X**2 + b1*X + b0
+ *
+ * Their product r = a*b is a polynomial of degree 4, which is determined by
+ * its values at 0, 1, -1, -2 and infinity: those only take 5 products of
+ * numbers a third of the size.  The evaluation and interpolation sequences
+ * are those of Bodrato and Zanoni, "Integer and Polynomial Multiplication:
+ * Towards Optimal Toom-Cook Matrices" (2007), which use a single exact
+ * division by 3.
+ */
+
+/* Evaluate x2*X**2 + x1*X + x0 at 1, -1 and -2. */
+static int
+toom3_evaluate(PyLongObject *x0, PyLongObject *x1, PyLongObject *x2,
+               PyLongObject **p1, PyLongObject **pm1, PyLongObject **pm2)
+{
+    PyLongObject *t, *u;
+
+    t = (PyLongObject *)long_add(x0, x2);
+    if (t == NULL) {
+        return -1;
+    }
+    *p1 = (PyLongObject *)long_add(t, x1);
+    *pm1 = (PyLongObject *)long_sub(t, x1);
+    Py_DECREF(t);
+    if (*p1 == NULL || *pm1 == NULL) {
+        goto Error;
+    }
+    /* pm2 = (pm1 + x2) * 2 - x0 */
+    t = (PyLongObject *)long_add(*pm1, x2);
+    if (t == NULL) {
+        goto Error;
+    }
+    u = (PyLongObject *)_PyLong_Lshift((PyObject *)t, 1);
+    Py_DECREF(t);
+    if (u == NULL) {
+        goto Error;
+    }
+    *pm2 = (PyLongObject *)long_sub(u, x0);
+    Py_DECREF(u);
+    if (*pm2 == NULL) {
+        goto Error;
+    }
+    return 0;
+
+  Error:
+    Py_CLEAR(*p1);
+    Py_CLEAR(*pm1);
+    return -1;
+}
+
+/* Return x / 3 for a multiple x of 3. */
+static PyLongObject *
+long_divexact3(PyLongObject *x)
+{
+    PyLongObject *z;
+    digit rem;
+
+    z = divrem1(x, 3, &rem);
+    if (z == NULL) {
+        return NULL;
+    }
+    assert(rem == 0);
+    if (Py_SIZE(x) < 0) {
+        Py_SET_SIZE(z, -Py_SIZE(z));
+    }
+    return z;
+}
+
+static PyLongObject *
+toom3_mul(PyLongObject *a, PyLongObject *b)
+{
+    Py_ssize_t asize = Py_ABS(Py_SIZE(a));
+    Py_ssize_t bsize = Py_ABS(Py_SIZE(b));
+    Py_ssize_t k = (Py_MAX(asize, bsize) + 2) / 3, i;
+    PyLongObject *x[3] = {NULL, NULL, NULL}, *y[3] = {NULL, NULL, NULL};
+    PyLongObject *pa[3] = {NULL, NULL, NULL}, *pb[3] = {NULL, NULL, NULL};
+    /* values of the product at 0, 1, -1, -2 and infinity, then its
+       coefficients */
+    PyLongObject *r[5] = {NULL, NULL, NULL, NULL, NULL};
+    PyLongObject *ret = NULL, *t, *hi;
+
+    /* Split a & b into three pieces. */
+    if (kmul_split(a, k, &hi, &x[0]) < 0) {
+        goto done;
+    }
+    i = kmul_split(hi, k, &x[2], &x[1]);
+    Py_DECREF(hi);
+    if (i < 0 || toom3_evaluate(x[0], x[1], x[2], &pa[0], &pa[1], &pa[2]) < 0) {
+        goto done;
+    }
+    if (a == b) {
+        for (i = 0; i < 3; i++) {
+            y[i] = x[i];
+            pb[i] = pa[i];
+            Py_INCREF(y[i]);
+            Py_INCREF(pb[i]);
+        }
+    }
+    else {
+        if (kmul_split(b, k, &hi, &y[0]) < 0) {
+            goto done;
+        }
+        i = kmul_split(hi, k, &y[2], &y[1]);
+        Py_DECREF(hi);
+        if (i < 0 ||
+            toom3_evaluate(y[0], y[1], y[2], &pb[0], &pb[1], &pb[2]) < 0) {
+            goto done;
+        }
+    }
+
+    /* Pointwise products.  Squares stay squares, as a == b implies
+       pa[i] == pb[i]. */
+    if ((r[0] = (PyLongObject *)long_mul(x[0], y[0])) == NULL ||
+        (r[1] = (PyLongObject *)long_mul(pa[0], pb[0])) == NULL ||
+        (r[2] = (PyLongObject *)long_mul(pa[1], pb[1])) == NULL ||
+        (r[3] = (PyLongObject *)long_mul(pa[2], pb[2])) == NULL ||
+        (r[4] = (PyLongObject *)long_mul(x[2], y[2])) == NULL) {
+        goto done;
+    }
+
+    /* Interpolation:
+         r3 = (r(-2) - r(1)) / 3
+         r1 = (r(1) - r(-1)) / 2
+         r2 = r(-1) - r(0)
+         r3 = (r2 - r3) / 2 + 2 * r(inf)
+         r2 = r2 + r1 - r(inf)
+         r1 = r1 - r3
+    */
+#define TOOM3_SETREF(var, expr)         \
+    do {                                \
+        t = (PyLongObject *)(expr);     \
+        if (t == NULL) {                \
+            goto done;                  \
+        }                               \
+        Py_SETREF(var, t);              \
+    } while (0)
+
+    TOOM3_SETREF(r[3], long_sub(r[3], r[1]));
+    TOOM3_SETREF(r[3], long_divexact3(r[3]));
+    TOOM3_SETREF(r[1], long_sub(r[1], r[2]));
+    TOOM3_SETREF(r[1], _PyLong_Rshift((PyObject *)r[1], 1));
+    TOOM3_SETREF(r[2], long_sub(r[2], r[0]));
+    TOOM3_SETREF(r[3], long_sub(r[2], r[3]));
+    TOOM3_SETREF(r[3], _PyLong_Rshift((PyObject *)r[3], 1));
+    TOOM3_SETREF(r[3], long_add(r[3], r[4]));
+    TOOM3_SETREF(r[3], long_add(r[3], r[4]));
+    TOOM3_SETREF(r[2], long_add(r[2], r[1]));
+    TOOM3_SETREF(r[2], long_sub(r[2], r[4]));
+    TOOM3_SETREF(r[1], long_sub(r[1], r[3]));
+#undef TOOM3_SETREF
+
+    /* The coefficients are nonnegative, and r[i] * X**i fits in the
+       asize + bsize digits of the result. */
+    ret = _PyLong_New(asize + bsize);
+    if (ret == NULL) {
+        goto done;
+    }
+    memset(ret->ob_digit, 0, Py_SIZE(ret) * sizeof(digit));
+    for (i = 0; i < 5; i++) {
+        assert(Py_SIZE(r[i]) >= 0);
+        assert(Py_SIZE(r[i]) == 0 || i * k + Py_SIZE(r[i]) <= Py_SIZE(ret));
+        if (Py_SIZE(r[i]) > 0) {
+            (void)v_iadd(ret->ob_digit + i * k, Py_SIZE(ret) - i * k,
+                         r[i]->ob_digit, Py_SIZE(r[i]));
+        }
+    }
+    ret = long_normalize(ret);
+
+  done:
+    for (i = 0; i < 3; i++) {
+        Py_XDECREF(x[i]);
+        Py_XDECREF(y[i]);
+        Py_XDECREF(pa[i]);
+        Py_XDECREF(pb[i]);
+    }
+    for (i = 0; i < 5; i++) {
+        Py_XDECREF(r[i]);
+    }
+    return ret;
+}
+
+#if PyLong_SHIFT == 30
+/* Multiplication by number-theoretic transform.  Ignores the input signs,
+ * and returns the absolute value of the product (or NULL if error).
+ *
+ * The digits of a and b are the coefficients of two polynomials, whose
+ * product is computed with fast Fourier transforms modulo three primes of the
+ * form c * 2**k + 1.  Each coefficient of the product is less than
+ * min(asize, bsize) * BASE**2, so the Chinese remainder theorem recovers them
+ * exactly as long as that is smaller than the product of the primes, about
+ * 2**90.  The transforms have a length of at most 2**NTT_MAX_LOG2.
+ */
+#define NTT_MAX_LOG2 26
+#define NTT_P0 2013265921U      /* 15 * 2**27 + 1 */
+#define NTT_P1 1811939329U      /* 27 * 2**26 + 1 */
+#define NTT_P2 469762049U       /*  7 * 2**26 + 1 */
+#define NTT_G0 31               /* primitive roots */
+#define NTT_G1 13
+#define NTT_G2 3
+
+static inline uint32_t
+ntt_mulmod(uint32_t a, uint32_t b, uint32_t p)
+{
+    return (uint32_t)((uint64_t)a * b % p);
+}
+
+static uint32_t
+ntt_powmod(uint32_t a, uint32_t e, uint32_t p)
+{
+    uint32_t r = 1;
+    while (e) {
+        if (e & 1) {
+            r = ntt_mulmod(r, a, p);
+        }
+        a = ntt_mulmod(a, a, p);
+        e >>= 1;
+    }
+    return r;
+}
+
+/* Multiply a < 2**32 by w modulo p, wp being floor(w * 2**32 / p) (Shoup's
+   method).  The product is computed modulo 2**32, and only needs one
+   correction. */
+static inline uint32_t
+ntt_mulmod_shoup(uint32_t a, uint32_t w, uint32_t wp, uint32_t p)
+{
+    uint32_t q = (uint32_t)(((uint64_t)a * wp) >> 32);
+    uint32_t r = a * w - q * p;
+    return r >= p ? r - p : r;
+}
+
+/* Compute the half = len/2 twiddle factors of a stage, w[k] = root**k with
+   root of order len, and their Shoup quotients in wp. */
+static inline Py_ALWAYS_INLINE void
+ntt_twiddles(uint32_t *w, uint32_t *wp, size_t len, int inverse,
+             uint32_t p, uint32_t g)
+{
+    uint32_t root = ntt_powmod(g, (uint32_t)((p - 1) / len), p);
+    size_t k;
+
+    if (inverse) {
+        root = ntt_powmod(root, p - 2, p);
+    }
+    w[0] = 1;
+    for (k = 1; k < len / 2; k++) {
+        w[k] = ntt_mulmod(w[k - 1], root, p);
+    }
+    for (k = 0; k < len / 2; k++) {
+        wp[k] = (uint32_t)(((uint64_t)w[k] << 32) / p);
+    }
+}
+
+/* In-place transform of a[0:n] modulo p, n being a power of 2, using
+   w[0:n] as scratch space for the twiddle factors.  The forward transform
+   (decimation in frequency) leaves its output in bit-reversed order, which
+   is the input order of the inverse one (decimation in time), so that no
+   permutation is needed.  This is inlined with a constant p, so that the
+   compiler can turn the reductions into multiplications. */
+static inline Py_ALWAYS_INLINE void
+ntt_transform_impl(uint32_t *a, size_t n, int inverse, uint32_t *w,
+                   uint32_t p, uint32_t g)
+{
+    uint32_t *wp = w + n / 2;
+    size_t i, k, len, half;
+
+    if (!inverse) {
+        for (len = n; len >= 2; len >>= 1) {
+            half = len >> 1;
+            ntt_twiddles(w, wp, len, 0, p, g);
+            for (i = 0; i < n; i += len) {
+                uint32_t *x = a + i, *y = a + i + half;
+                for (k = 0; k < half; k++) {
+                    uint32_t u = x[k], v = y[k];
+                    x[k] = u + v >= p ? u + v - p : u + v;
+                    y[k] = ntt_mulmod_shoup(u + p - v, w[k], wp[k], p);
+                }
+            }
+        }
+    }
+    else {
+        uint32_t ninv;
+        for (len = 2; len <= n; len <<= 1) {
+            half = len >> 1;
+            ntt_twiddles(w, wp, len, 1, p, g);
+            for (i = 0; i < n; i += len) {
+                uint32_t *x = a + i, *y = a + i + half;
+                for (k = 0; k < half; k++) {
+                    uint32_t u = x[k];
+                    uint32_t v = ntt_mulmod_shoup(y[k], w[k], wp[k], p);
+                    x[k] = u + v >= p ? u + v - p : u + v;
+                    y[k] = u >= v ? u - v : u + p - v;
+                }
+            }
+        }
+        ninv = ntt_powmod((uint32_t)(n % p), p - 2, p);
+        for (i = 0; i < n; i++) {
+            a[i] = ntt_mulmod(a[i], ninv, p);
+        }
+    }
+}
+
+static void
+ntt_transform(uint32_t *a, size_t n, int inverse, uint32_t *w, int prime)
+{
+    switch (prime) {
+    case 0:
+        ntt_transform_impl(a, n, inverse, w, NTT_P0, NTT_G0);
+        break;
+    case 1:
+        ntt_transform_impl(a, n, inverse, w, NTT_P1, NTT_G1);
+        break;
+    default:
+        ntt_transform_impl(a, n, inverse, w, NTT_P2, NTT_G2);
+        break;
+    }
+}
+
+/* Set res[0:n] to the cyclic convolution of the digits of a and b modulo
+   the given prime.  fb and w are scratch space of n words each. */
+static void
+ntt_convolve(PyLongObject *a, PyLongObject *b, uint32_t *res, uint32_t *fb,
+             uint32_t *w, size_t n, int prime)
+{
+    static const uint32_t primes[3] = {NTT_P0, NTT_P1, NTT_P2};
+    const uint32_t p = primes[prime];
+    size_t asize = Py_ABS(Py_SIZE(a)), bsize = Py_ABS(Py_SIZE(b)), i;
+
+    for (i = 0; i < asize; i++) {
+        res[i] = a->ob_digit[i] % p;
+    }
+    memset(res + asize, 0, (n - asize) * sizeof(uint32_t));
+    ntt_transform(res, n, 0, w, prime);
+    if (a == b) {
+        for (i = 0; i < n; i++) {
+            res[i] = ntt_mulmod(res[i], res[i], p);
+        }
+    }
+    else {
+        for (i = 0; i < bsize; i++) {
+            fb[i] = b->ob_digit[i] % p;
+        }
+        memset(fb + bsize, 0, (n - bsize) * sizeof(uint32_t));
+        ntt_transform(fb, n, 0, w, prime);
+        for (i = 0; i < n; i++) {
+            res[i] = ntt_mulmod(res[i], fb[i], p);
+        }
+    }
+    ntt_transform(res, n, 1, w, prime);
+}
+
+static PyLongObject *
+ntt_mul(PyLongObject *a, PyLongObject *b)
+{
+    Py_ssize_t asize = Py_ABS(Py_SIZE(a));
+    Py_ssize_t bsize = Py_ABS(Py_SIZE(b));
+    PyLongObject *ret;
+    uint32_t *buf, *r0, *r1, *r2;
+    uint32_t inv01, inv012;
+    uint64_t acc0 = 0, acc1 = 0, acc2 = 0;
+    size_t n = 2;
+    Py_ssize_t i;
+
+    assert(asize + bsize <= ((Py_ssize_t)1 << NTT_MAX_LOG2));
+    while (n < (size_t)(asize + bsize - 1)) {
+        n <<= 1;
+    }
+    ret = _PyLong_New(asize + bsize);
+    if (ret == NULL) {
+        return NULL;
+    }
+    /* three residues, the second operand and the twiddle factors */
+    buf = PyMem_New(uint32_t, 5 * n);
+    if (buf == NULL) {
+        Py_DECREF(ret);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    r0 = buf;
+    r1 = buf + n;
+    r2 = buf + 2 * n;
+    ntt_convolve(a, b, r0, buf + 3 * n, buf + 4 * n, n, 0);
+    ntt_convolve(a, b, r1, buf + 3 * n, buf + 4 * n, n, 1);
+    ntt_convolve(a, b, r2, buf + 3 * n, buf + 4 * n, n, 2);
+
+    /* Combine the residues with Garner's algorithm: the coefficient is
+       r0 + P0 * (v1 + P1 * v2), with 0 <= v1 < P1 and 0 <= v2 < P2.  It is
+       added into the result as A + B * BASE, A and B being less than 2**62. */
+    inv01 = ntt_powmod(NTT_P0 % NTT_P1, NTT_P1 - 2, NTT_P1);
+    inv012 = ntt_powmod(ntt_mulmod(NTT_P0 % NTT_P2, NTT_P1 % NTT_P2, NTT_P2),
+                        NTT_P2 - 2, NTT_P2);
+    for (i = 0; i < asize + bsize; i++) {
+        uint64_t A = 0, B = 0;
+        if ((size_t)i < n) {
+            uint32_t v1, v2, t;
+            uint64_t u;
+            v1 = ntt_mulmod((r1[i] + NTT_P1 - r0[i] % NTT_P1) % NTT_P1,
+                            inv01, NTT_P1);
+            /* t = r0 + P0 * v1 (mod P2) */
+            t = (uint32_t)((r0[i] + (uint64_t)NTT_P0 * v1) % NTT_P2);
+            v2 = ntt_mulmod((r2[i] + NTT_P2 - t) % NTT_P2, inv012, NTT_P2);
+            u = v1 + (uint64_t)NTT_P1 * v2;
+            A = r0[i] + (uint64_t)NTT_P0 * (u & PyLong_MASK);
+            B = (uint64_t)NTT_P0 * (u >> PyLong_SHIFT);
+        }
+        acc0 += A & PyLong_MASK;
+        acc1 += (A >> PyLong_SHIFT) + (B & PyLong_MASK);
+        acc2 += B >> PyLong_SHIFT;
+        ret->ob_digit[i] = (digit)(acc0 & PyLong_MASK);
+        acc0 = acc1 + (acc0 >> PyLong_SHIFT);
+        acc1 = acc2;
+        acc2 = 0;
+    }
+    assert(acc0 == 0 && acc1 == 0);
+    PyMem_Free(buf);
+    return long_normalize(ret);
+}
+#endif /* PyLong_SHIFT == 30 */
+
 /* Karatsuba multiplication.  Ignores the input signs, and returns the
  * absolute value of the product (or NULL if error).
  * See Knuth Vol. 2 Chapter 4.3.3 (Pp. 294-295).
  */
 static PyLongObject *
-k_mul(PyLongObject *a, PyLongObject *b)
+karatsuba_mul(PyLongObject *a, PyLongObject *b)
 {
     Py_ssize_t asize = Py_ABS(Py_SIZE(a));
     Py_ssize_t bsize = Py_ABS(Py_SIZE(b));
@@ -3593,6 +4794,77 @@ k_lopsided_mul(PyLongObject *a, PyLongObject *b)
     return NULL;
 }
 
+/* Multiply a and b with the fastest algorithm for their sizes.  Ignores the
+ * input signs, and returns the absolute value of the product (or NULL if
+ * error).
+ */
+static PyLongObject *
+k_mul(PyLongObject *a, PyLongObject *b)
+{
+    Py_ssize_t asize = Py_ABS(Py_SIZE(a));
+    Py_ssize_t bsize = Py_ABS(Py_SIZE(b));
+    Py_ssize_t minsize = Py_MIN(asize, bsize);
+    Py_ssize_t maxsize = Py_MAX(asize, bsize);
+
+#if PyLong_SHIFT == 30
+    if (minsize >= (a == b ? NTT_SQUARE_CUTOFF : NTT_CUTOFF) &&
+        asize + bsize <= ((Py_ssize_t)1 << NTT_MAX_LOG2)) {
+        return ntt_mul(a, b);
+    }
+#endif
+    /* Toom-3 needs balanced sizes, like Karatsuba */
+    if (minsize >= TOOM3_CUTOFF && 2 * minsize > maxsize) {
+        return toom3_mul(a, b);
+    }
+    return karatsuba_mul(a, b);
+}
+
+/* Multiply a and b with the given algorithm, for tests and benchmarks:
+ * 0 for the school algorithm, 1 for Karatsuba, 2 for Toom-3 and 3 for the
+ * number-theoretic transform.  Only the top-level product uses it, the
+ * smaller ones use the fastest algorithm.
+ */
+PyObject *
+_PyLong_MulWithAlgorithm(PyObject *a, PyObject *b, int algorithm)
+{
+    PyLongObject *x = (PyLongObject *)a, *y = (PyLongObject *)b, *z;
+    Py_ssize_t xsize = Py_ABS(Py_SIZE(x)), ysize = Py_ABS(Py_SIZE(y));
+
+    assert(PyLong_Check(a) && PyLong_Check(b));
+    if (xsize == 0 || ysize == 0) {
+        return PyLong_FromLong(0);
+    }
+    switch (algorithm) {
+    case 0:
+        z = x_mul(x, y);
+        break;
+    case 1:
+        z = karatsuba_mul(x, y);
+        break;
+    case 2:
+        z = toom3_mul(x, y);
+        break;
+    case 3:
+#if PyLong_SHIFT == 30
+        if (xsize + ysize <= ((Py_ssize_t)1 << NTT_MAX_LOG2)) {
+            z = ntt_mul(x, y);
+            break;
+        }
+#endif
+        PyErr_SetString(PyExc_OverflowError,
+                        "operands too large for the number-theoretic "
+                        "transform");
+        return NULL;
+    default:
+        PyErr_SetString(PyExc_ValueError, "unknown multiplication algorithm");
+        return NULL;
+    }
+    if (((Py_SIZE(x) ^ Py_SIZE(y)) < 0) && z) {
+        _PyLong_Negate(&z);
+    }
+    return (PyObject *)maybe_small_long(z);
+}
+
 static PyObject *
 long_mul(PyLongObject *a, PyLongObject *b)
 {
@@ -4157,6 +5429,185 @@ long_invmod(PyLongObject *a, PyLongObject *n)
 }
 
 
+/* Montgomery multiplication (HAC Algorithm 14.36, with the two inner loops
+ * fused): z = x*y/R mod m, where R = PyLong_BASE**n, m is odd and
+ * x, y < m.  minv is -1/m modulo PyLong_BASE, and t is scratch space for
+ * n+1 digits.  z may alias x or y.
+ */
+static void
+montgomery_mul(digit *z, const digit *x, const digit *y, const digit *m,
+               Py_ssize_t n, digit minv, digit *t)
+{
+    Py_ssize_t i, j;
+
+    memset(t, 0, (n + 1) * sizeof(digit));
+    for (i = 0; i < n; i++) {
+        const twodigits yi = y[i];
+        twodigits carry = t[0] + x[0] * yi;
+        const twodigits u = ((carry & PyLong_MASK) * minv) & PyLong_MASK;
+
+        /* The low digit of carry + u*m[0] is 0 by the choice of u. */
+        carry = (carry + u * m[0]) >> PyLong_SHIFT;
+        for (j = 1; j < n; j++) {
+            carry += t[j] + x[j] * yi + u * m[j];
+            t[j-1] = (digit)(carry & PyLong_MASK);
+            carry >>= PyLong_SHIFT;
+        }
+        carry += t[n];
+        t[n-1] = (digit)(carry & PyLong_MASK);
+        t[n] = (digit)(carry >> PyLong_SHIFT);
+    }
+
+    /* Now t < 2*m; subtract m once if t >= m. */
+    if (t[n] == 0) {
+        for (j = n - 1; j >= 0 && t[j] == m[j]; j--)
+            ;
+        if (j >= 0 && t[j] < m[j]) {
+            memcpy(z, t, n * sizeof(digit));
+            return;
+        }
+    }
+    digit borrow = 0;
+    for (j = 0; j < n; j++) {
+        borrow = t[j] - m[j] - borrow;
+        z[j] = borrow & PyLong_MASK;
+        borrow >>= PyLong_SHIFT;
+        borrow &= 1;
+    }
+}
+
+/* Bit k of the non-negative int b. */
+static inline int
+long_test_bit(PyLongObject *b, uint64_t k)
+{
+    return (b->ob_digit[k / PyLong_SHIFT] >> (k % PyLong_SHIFT)) & 1;
+}
+
+/* pow(a, b, m) for 0 <= a, 0 < b and an odd modulus 1 < m of at most
+ * MONTGOMERY_CUTOFF digits, using left-to-right sliding window
+ * exponentiation (HAC Algorithm 14.85) on Montgomery representations.
+ */
+static PyLongObject *
+long_pow_montgomery(PyLongObject *a, PyLongObject *b, PyLongObject *m)
+{
+    const Py_ssize_t n = Py_SIZE(m);
+    PyLongObject *am = NULL, *z = NULL, *temp;
+    digit *buf = NULL, *table, *acc, *scratch;
+    twodigits minv;
+    uint64_t nbits, i, l;
+    int window, value, first;
+    Py_ssize_t k;
+
+    assert(Py_SIZE(a) >= 0 && Py_SIZE(b) > 0);
+    assert(n > 0 && n <= MONTGOMERY_CUTOFF && (m->ob_digit[0] & 1));
+
+    /* am = a*R % m */
+    if (Py_SIZE(a) == 0) {
+        return (PyLongObject *)PyLong_FromLong(0);
+    }
+    temp = (PyLongObject *)_PyLong_Lshift((PyObject *)a,
+                                          (size_t)n * PyLong_SHIFT);
+    if (temp == NULL) {
+        return NULL;
+    }
+    k = l_divmod(temp, m, NULL, &am);
+    Py_DECREF(temp);
+    if (k < 0) {
+        return NULL;
+    }
+
+    nbits = (uint64_t)(Py_SIZE(b) - 1) * PyLong_SHIFT +
+            bit_length_digit(b->ob_digit[Py_SIZE(b) - 1]);
+    window = nbits > 671 ? 6 : nbits > 239 ? 5 : nbits > 79 ? 4 :
+             nbits > 23 ? 3 : 1;
+
+    /* table[k] holds a**(2*k+1) for k < 2**(window-1), followed by the
+       accumulator and n+1 digits of scratch space. */
+    buf = PyMem_New(digit, (((Py_ssize_t)1 << (window - 1)) + 2) * n + 1);
+    if (buf == NULL) {
+        PyErr_NoMemory();
+        goto Error;
+    }
+    table = buf;
+    acc = buf + ((Py_ssize_t)1 << (window - 1)) * n;
+    scratch = acc + n;
+
+    /* minv = -1/m % PyLong_BASE by Newton's method; m[0] is its own
+       inverse modulo 8, and each step doubles the number of correct
+       bits. */
+    minv = m->ob_digit[0];
+    for (k = 0; k < 5; k++) {
+        minv = (minv * (2 - m->ob_digit[0] * minv)) & PyLong_MASK;
+    }
+    minv = (PyLong_BASE - minv) & PyLong_MASK;
+
+    memset(table, 0, n * sizeof(digit));
+    memcpy(table, am->ob_digit, Py_SIZE(am) * sizeof(digit));
+    if (window > 1) {
+        montgomery_mul(acc, table, table, m->ob_digit, n, (digit)minv,
+                       scratch);
+        for (k = 1; k < ((Py_ssize_t)1 << (window - 1)); k++) {
+            montgomery_mul(table + k*n, table + (k-1)*n, acc, m->ob_digit,
+                           n, (digit)minv, scratch);
+        }
+    }
+
+    first = 1;
+    i = nbits;
+    while (i > 0) {
+        SIGCHECK({
+                goto Error;
+            });
+        i--;
+        if (!long_test_bit(b, i)) {
+            assert(!first);
+            montgomery_mul(acc, acc, acc, m->ob_digit, n, (digit)minv,
+                           scratch);
+            continue;
+        }
+        /* The longest window b[i:l] of at most `window` bits that ends
+           with a one bit. */
+        l = i + 1 >= (uint64_t)window ? i + 1 - window : 0;
+        while (!long_test_bit(b, l)) {
+            l++;
+        }
+        value = 0;
+        for (uint64_t j = i + 1; j-- > l; ) {
+            value = (value << 1) | long_test_bit(b, j);
+            if (!first) {
+                montgomery_mul(acc, acc, acc, m->ob_digit, n, (digit)minv,
+                               scratch);
+            }
+        }
+        if (first) {
+            memcpy(acc, table + (value >> 1) * n, n * sizeof(digit));
+            first = 0;
+        }
+        else {
+            montgomery_mul(acc, acc, table + (value >> 1) * n, m->ob_digit,
+                           n, (digit)minv, scratch);
+        }
+        i = l;
+    }
+
+    /* Leave Montgomery form: multiply by 1. */
+    memset(table, 0, n * sizeof(digit));
+    table[0] = 1;
+    z = _PyLong_New(n);
+    if (z == NULL) {
+        goto Error;
+    }
+    montgomery_mul(z->ob_digit, acc, table, m->ob_digit, n, (digit)minv,
+                   scratch);
+    z = long_normalize(z);
+
+  Error:
+    PyMem_Free(buf);
+    Py_XDECREF(am);
+    return z;
+}
+
+
 /* pow(v, w, x) */
 static PyObject *
 long_pow(PyObject *v, PyObject *w, PyObject *x)
@@ -4325,6 +5776,15 @@ long_pow(PyObject *v, PyObject *w, PyObject *x)
         }
         /* else bi is 0, and z==1 is correct */
     }
+    else if (c != NULL && Py_SIZE(c) <= MONTGOMERY_CUTOFF &&
+             (c->ob_digit[0] & 1)) {
+        temp = long_pow_montgomery(a, b, c);
+        if (temp == NULL)
+            goto Error;
+        Py_DECREF(z);
+        z = temp;
+        temp = NULL;
+    }
     else if (i <= FIVEARY_CUTOFF) {
         /* Left-to-right binary exponentiation (HAC Algorithm 14.79) */
         /* http://www.cacr.math.uwaterloo.ca/hac/about/chap14.pdf    */
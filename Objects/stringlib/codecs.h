@@ -32,6 +32,43 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
         ch = (unsigned char)*s;
 
         if (ch < 0x80) {
+#ifdef _Py_HAVE_SSE2
+            /* Fast path for runs of ASCII characters: check 16 bytes at a
+               time and widen them to the output kind. */
+            while (end - s >= 16) {
+                __m128i chunk = _mm_loadu_si128((const __m128i *)s);
+                int mask = _mm_movemask_epi8(chunk);
+                if (mask) {
+                    /* Copy the ASCII bytes before the first non-ASCII one. */
+                    const char *stop = s + _Py_ctz32(mask);
+                    while (s < stop) {
+                        *p++ = (unsigned char)*s++;
+                    }
+                    break;
+                }
+# if STRINGLIB_SIZEOF_CHAR == 1
+                _mm_storeu_si128((__m128i *)p, chunk);
+# else
+                const __m128i zero = _mm_setzero_si128();
+                __m128i lo = _mm_unpacklo_epi8(chunk, zero);
+                __m128i hi = _mm_unpackhi_epi8(chunk, zero);
+#  if STRINGLIB_SIZEOF_CHAR == 2
+                _mm_storeu_si128((__m128i *)p, lo);
+                _mm_storeu_si128((__m128i *)(p + 8), hi);
+#  else
+                _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128((__m128i *)(p + 4), _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128((__m128i *)(p + 8), _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128((__m128i *)(p + 12), _mm_unpackhi_epi16(hi, zero));
+#  endif
+# endif
+                s += 16;
+                p += 16;
+            }
+            if (s == end)
+                break;
+            ch = (unsigned char)*s;
+#else
             /* Fast path for runs of ASCII characters. Given that common UTF-8
                input will consist of an overwhelming majority of ASCII
                characters, we try to optimize for this case by checking
@@ -87,6 +124,7 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                     break;
                 ch = (unsigned char)*s;
             }
+#endif /* _Py_HAVE_SSE2 */
             if (ch < 0x80) {
                 s++;
                 *p++ = ch;
@@ -298,7 +336,56 @@ STRINGLIB(utf8_encoder)(_PyBytesWriter *writer,
         if (ch < 0x80) {
             /* Encode ASCII */
             *p++ = (char) ch;
-
+#ifdef _Py_HAVE_SSE2
+            /* Copy the run of ASCII characters that follows 16 at a time.
+               All 16 bytes are stored; those after the first non-ASCII
+               character are overwritten later. */
+            while (size - i >= 16) {
+                const STRINGLIB_CHAR *q = data + i;
+                __m128i bytes, ascii;
+# if STRINGLIB_SIZEOF_CHAR == 1
+                bytes = _mm_loadu_si128((const __m128i *)q);
+                ascii = _mm_cmpgt_epi8(bytes, _mm_set1_epi8(-1));
+# elif STRINGLIB_SIZEOF_CHAR == 2
+                const __m128i high = _mm_set1_epi16((short)0xFF80);
+                const __m128i zero = _mm_setzero_si128();
+                __m128i v0 = _mm_loadu_si128((const __m128i *)q);
+                __m128i v1 = _mm_loadu_si128((const __m128i *)(q + 8));
+                v0 = _mm_cmpeq_epi16(_mm_and_si128(v0, high), zero);
+                v1 = _mm_cmpeq_epi16(_mm_and_si128(v1, high), zero);
+                ascii = _mm_packs_epi16(v0, v1);
+                bytes = _mm_packus_epi16(
+                    _mm_loadu_si128((const __m128i *)q),
+                    _mm_loadu_si128((const __m128i *)(q + 8)));
+# else
+                const __m128i high = _mm_set1_epi32((int)0xFFFFFF80);
+                const __m128i zero = _mm_setzero_si128();
+                __m128i v0 = _mm_loadu_si128((const __m128i *)q);
+                __m128i v1 = _mm_loadu_si128((const __m128i *)(q + 4));
+                __m128i v2 = _mm_loadu_si128((const __m128i *)(q + 8));
+                __m128i v3 = _mm_loadu_si128((const __m128i *)(q + 12));
+                /* Non-ASCII lanes saturate; they are not used. */
+                bytes = _mm_packus_epi16(_mm_packs_epi32(v0, v1),
+                                         _mm_packs_epi32(v2, v3));
+                v0 = _mm_cmpeq_epi32(_mm_and_si128(v0, high), zero);
+                v1 = _mm_cmpeq_epi32(_mm_and_si128(v1, high), zero);
+                v2 = _mm_cmpeq_epi32(_mm_and_si128(v2, high), zero);
+                v3 = _mm_cmpeq_epi32(_mm_and_si128(v3, high), zero);
+                ascii = _mm_packs_epi16(_mm_packs_epi32(v0, v1),
+                                        _mm_packs_epi32(v2, v3));
+# endif
+                _mm_storeu_si128((__m128i *)p, bytes);
+                int nonascii = ~_mm_movemask_epi8(ascii) & 0xFFFF;
+                if (nonascii) {
+                    int n = _Py_ctz32(nonascii);
+                    p += n;
+                    i += n;
+                    break;
+                }
+                p += 16;
+                i += 16;
+            }
+#endif
         }
         else
 #if STRINGLIB_SIZEOF_CHAR > 1
@@ -2,6 +2,9 @@
 
 #define STRINGLIB_FASTSEARCH_H
 
+#include "pycore_bitutils.h"      // _Py_ctz32()
+#include "pycore_simd.h"          // _Py_HAVE_SSE2
+
 /* fast search/count implementation, based on a mix between boyer-
    moore and horspool, with a few more bells and whistles on the top.
    for some more background, see:
@@ -45,6 +48,44 @@
 #  define MEMCHR_CUT_OFF 40
 #endif
 
+#ifdef _Py_HAVE_SSE2
+/* SSE2 helpers working on blocks of 16 characters: a comparison of each
+   character gives one byte of 0xFF or 0 in the result, in order, so that
+   _mm_movemask_epi8() gives one bit per character. */
+
+Py_LOCAL_INLINE(__m128i)
+STRINGLIB(_splat)(STRINGLIB_CHAR ch)
+{
+#if STRINGLIB_SIZEOF_CHAR == 1
+    return _mm_set1_epi8((char)ch);
+#elif STRINGLIB_SIZEOF_CHAR == 2
+    return _mm_set1_epi16((short)ch);
+#else
+    return _mm_set1_epi32((int)ch);
+#endif
+}
+
+Py_LOCAL_INLINE(__m128i)
+STRINGLIB(_eq16)(const STRINGLIB_CHAR *s, __m128i splat)
+{
+#if STRINGLIB_SIZEOF_CHAR == 1
+    return _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)s), splat);
+#elif STRINGLIB_SIZEOF_CHAR == 2
+    return _mm_packs_epi16(
+        _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)s), splat),
+        _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(s + 8)), splat));
+#else
+    return _mm_packs_epi16(
+        _mm_packs_epi32(
+            _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)s), splat),
+            _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(s + 4)), splat)),
+        _mm_packs_epi32(
+            _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(s + 8)), splat),
+            _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(s + 12)), splat)));
+#endif
+}
+#endif /* _Py_HAVE_SSE2 */
+
 Py_LOCAL_INLINE(Py_ssize_t)
 STRINGLIB(find_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
 {
@@ -722,8 +763,24 @@ static inline Py_ssize_t
 STRINGLIB(count_char)(const STRINGLIB_CHAR *s, Py_ssize_t n,
                       const STRINGLIB_CHAR p0, Py_ssize_t maxcount)
 {
-    Py_ssize_t i, count = 0;
-    for (i = 0; i < n; i++) {
+    Py_ssize_t i = 0, count = 0;
+#ifdef _Py_HAVE_SSE2
+    /* Count the matches in 8-bit lanes, summing them every 255 blocks. */
+    const __m128i splat = STRINGLIB(_splat)(p0);
+    while (n - i >= 16) {
+        Py_ssize_t nblocks = Py_MIN((n - i) / 16, 255);
+        __m128i counts = _mm_setzero_si128();
+        for (; nblocks > 0; nblocks--, i += 16) {
+            counts = _mm_sub_epi8(counts, STRINGLIB(_eq16)(s + i, splat));
+        }
+        counts = _mm_sad_epu8(counts, _mm_setzero_si128());
+        count += _mm_cvtsi128_si32(counts) + _mm_extract_epi16(counts, 4);
+        if (count >= maxcount) {
+            return maxcount;
+        }
+    }
+#endif
+    for (; i < n; i++) {
         if (s[i] == p0) {
             count++;
             if (count == maxcount) {
@@ -21,6 +21,18 @@ STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
 {
     const unsigned char *p = (const unsigned char *) begin;
 
+#ifdef _Py_HAVE_SSE2
+    while ((const unsigned char *)end - p >= 64) {
+        __m128i bits = _mm_or_si128(
+            _mm_or_si128(_mm_loadu_si128((const __m128i *)p),
+                         _mm_loadu_si128((const __m128i *)(p + 16))),
+            _mm_or_si128(_mm_loadu_si128((const __m128i *)(p + 32)),
+                         _mm_loadu_si128((const __m128i *)(p + 48))));
+        if (_mm_movemask_epi8(bits))
+            return 255;
+        p += 64;
+    }
+#endif
     while (p < end) {
         if (_Py_IS_ALIGNED(p, ALIGNOF_SIZE_T)) {
             /* Help register allocation */
@@ -72,8 +84,63 @@ STRINGLIB(find_max_char)(const STRINGLIB_CHAR *begin, const STRINGLIB_CHAR *end)
     const STRINGLIB_CHAR *unrolled_end = begin + _Py_SIZE_ROUND_DOWN(n, 4);
     Py_UCS4 max_char;
 
+#ifdef _Py_HAVE_SSE2
+    /* OR the characters together, 64 bytes at a time, until one of them
+       needs the widest kind. */
+    {
+# if STRINGLIB_SIZEOF_CHAR == 2
+        const __m128i limit = _mm_set1_epi16((short)MASK_UCS1);
+#  define CMPEQ _mm_cmpeq_epi16
+# else
+        const __m128i limit = _mm_set1_epi32((int)MASK_UCS2);
+#  define CMPEQ _mm_cmpeq_epi32
+# endif
+        const __m128i zero = _mm_setzero_si128();
+        const Py_ssize_t step = 64 / STRINGLIB_SIZEOF_CHAR;
+        __m128i acc = zero;
+        while (end - p >= step) {
+            __m128i bits = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_loadu_si128((const __m128i *)p),
+                    _mm_loadu_si128((const __m128i *)(p + step / 4))),
+                _mm_or_si128(
+                    _mm_loadu_si128((const __m128i *)(p + step / 2)),
+                    _mm_loadu_si128((const __m128i *)(p + 3 * step / 4))));
+            if (_mm_movemask_epi8(CMPEQ(_mm_and_si128(bits, limit), zero))
+                != 0xFFFF)
+            {
+                return max_char_limit;
+            }
+            acc = _mm_or_si128(acc, bits);
+            p += step;
+        }
+# undef CMPEQ
+        acc = _mm_or_si128(acc, _mm_srli_si128(acc, 8));
+        acc = _mm_or_si128(acc, _mm_srli_si128(acc, 4));
+# if STRINGLIB_SIZEOF_CHAR == 2
+        acc = _mm_or_si128(acc, _mm_srli_si128(acc, 2));
+# endif
+        Py_UCS4 bits = (Py_UCS4)_mm_cvtsi128_si32(acc);
+# if STRINGLIB_SIZEOF_CHAR == 2
+        bits &= 0xFFFF;
+# endif
+        if (bits & MASK_UCS1) {
+            max_char = MAX_CHAR_UCS2;
+            mask = MASK_UCS2;
+        }
+        else if (bits & MASK_ASCII) {
+            max_char = MAX_CHAR_UCS1;
+            mask = MASK_UCS1;
+        }
+        else {
+            max_char = MAX_CHAR_ASCII;
+            mask = MASK_ASCII;
+        }
+    }
+#else
     max_char = MAX_CHAR_ASCII;
     mask = MASK_ASCII;
+#endif
     while (p < unrolled_end) {
         STRINGLIB_CHAR bits = p[0] | p[1] | p[2] | p[3];
         if (bits & mask) {
@@ -50,6 +50,90 @@
 /* Always force the list to the expected size. */
 #define FIX_PREALLOC_SIZE(list) Py_SET_SIZE(list, count)
 
+#ifdef _Py_HAVE_SSE2
+/* Bytes of 0xFF where lo <= c <= hi, for 16 bytes c. */
+Py_LOCAL_INLINE(__m128i)
+STRINGLIB(_in_range_epi8)(__m128i v, char lo, char hi)
+{
+    __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(
+        _mm_subs_epu8(offset, _mm_set1_epi8((char)(hi - lo))),
+        _mm_setzero_si128());
+}
+
+#if STRINGLIB_SIZEOF_CHAR == 1
+/* Mask of the whitespace characters among the 16 at s. */
+Py_LOCAL_INLINE(uint32_t)
+STRINGLIB(_space_mask16)(const STRINGLIB_CHAR *s)
+{
+    const __m128i v = _mm_loadu_si128((const __m128i *)s);
+    /* \t \n \v \f \r and space */
+    __m128i space = _mm_or_si128(STRINGLIB(_in_range_epi8)(v, 0x09, 0x0D),
+                                 _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+#if STRINGLIB_IS_UNICODE
+    /* \x1c-\x1f, and \x85 and \xa0 in Latin-1 */
+    space = _mm_or_si128(space, STRINGLIB(_in_range_epi8)(v, 0x1C, 0x1F));
+    space = _mm_or_si128(space, _mm_cmpeq_epi8(v, _mm_set1_epi8((char)0x85)));
+    space = _mm_or_si128(space, _mm_cmpeq_epi8(v, _mm_set1_epi8((char)0xA0)));
+#endif
+    return (uint32_t)_mm_movemask_epi8(space);
+}
+#endif
+
+/* Mask of the line break characters among the 16 at s. */
+Py_LOCAL_INLINE(uint32_t)
+STRINGLIB(_linebreak_mask16)(const STRINGLIB_CHAR *s)
+{
+#if !STRINGLIB_IS_UNICODE
+    const __m128i v = _mm_loadu_si128((const __m128i *)s);
+    __m128i lb = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                              _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+#elif STRINGLIB_SIZEOF_CHAR == 1
+    /* \n \v \f \r, \x1c \x1d \x1e and \x85 */
+    const __m128i v = _mm_loadu_si128((const __m128i *)s);
+    __m128i lb = _mm_or_si128(STRINGLIB(_in_range_epi8)(v, 0x0A, 0x0D),
+                              STRINGLIB(_in_range_epi8)(v, 0x1C, 0x1E));
+    lb = _mm_or_si128(lb, _mm_cmpeq_epi8(v, _mm_set1_epi8((char)0x85)));
+#else
+    /* The same, and U+2028 and U+2029 */
+    __m128i lb[2];
+    for (int k = 0; k < 2; k++) {
+# if STRINGLIB_SIZEOF_CHAR == 2
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i v = _mm_loadu_si128((const __m128i *)(s + 8 * k));
+#  define IN_RANGE(lo, hi) \
+        _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(v, _mm_set1_epi16(lo)), \
+                                       _mm_set1_epi16((hi) - (lo))), zero)
+        lb[k] = _mm_or_si128(
+            _mm_or_si128(IN_RANGE(0x0A, 0x0D), IN_RANGE(0x1C, 0x1E)),
+            _mm_or_si128(IN_RANGE(0x85, 0x85), IN_RANGE(0x2028, 0x2029)));
+#  undef IN_RANGE
+# else
+        __m128i half[2];
+        for (int h = 0; h < 2; h++) {
+            const __m128i v = _mm_loadu_si128(
+                (const __m128i *)(s + 8 * k + 4 * h));
+#  define IN_RANGE(lo, hi) \
+            _mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32((lo) - 1)), \
+                          _mm_cmplt_epi32(v, _mm_set1_epi32((hi) + 1)))
+            half[h] = _mm_or_si128(
+                _mm_or_si128(IN_RANGE(0x0A, 0x0D), IN_RANGE(0x1C, 0x1E)),
+                _mm_or_si128(IN_RANGE(0x85, 0x85), IN_RANGE(0x2028, 0x2029)));
+#  undef IN_RANGE
+        }
+        lb[k] = _mm_packs_epi32(half[0], half[1]);
+# endif
+    }
+    lb[0] = _mm_packs_epi16(lb[0], lb[1]);
+#endif
+#if STRINGLIB_IS_UNICODE && STRINGLIB_SIZEOF_CHAR > 1
+    return (uint32_t)_mm_movemask_epi8(lb[0]);
+#else
+    return (uint32_t)_mm_movemask_epi8(lb);
+#endif
+}
+#endif /* _Py_HAVE_SSE2 */
+
 Py_LOCAL_INLINE(PyObject *)
 STRINGLIB(split_whitespace)(PyObject* str_obj,
                            const STRINGLIB_CHAR* str, Py_ssize_t str_len,
@@ -63,6 +147,41 @@ STRINGLIB(split_whitespace)(PyObject* str_obj,
         return NULL;
 
     i = j = 0;
+#if STRINGLIB_SIZEOF_CHAR == 1 && defined(_Py_HAVE_SSE2)
+    /* Split whole blocks of 16 characters.  Words start and end where the
+       whitespace mask differs from the mask shifted by one character. */
+    {
+        uint32_t prev = 1;     /* is the character before the block a space? */
+        int inword = 0;
+        while (str_len - i >= 16 && maxcount > 0) {
+            uint32_t space = STRINGLIB(_space_mask16)(str + i);
+            uint32_t edges = (space ^ ((space << 1) | prev)) & 0xFFFF;
+            prev = space >> 15;
+            Py_ssize_t block = i;
+            i += 16;
+            while (edges) {
+                Py_ssize_t k = block + _Py_ctz32(edges);
+                edges &= edges - 1;
+                if (!inword) {
+                    j = k;
+                    inword = 1;
+                    continue;
+                }
+                SPLIT_ADD(str, j, k);
+                inword = 0;
+                if (--maxcount == 0) {
+                    /* The rest of the string is the last item. */
+                    i = k;
+                    break;
+                }
+            }
+        }
+        if (inword) {
+            /* Let the loop below find the end of the current word. */
+            i = j;
+        }
+    }
+#endif
     while (maxcount-- > 0) {
         while (i < str_len && STRINGLIB_ISSPACE(str[i]))
             i++;
@@ -104,36 +223,59 @@ STRINGLIB(split_char)(PyObject* str_obj,
                      const STRINGLIB_CHAR ch,
                      Py_ssize_t maxcount)
 {
-    Py_ssize_t i, j, count=0;
-    PyObject *list = PyList_New(PREALLOC_SIZE(maxcount));
-    PyObject *sub;
+    Py_ssize_t i, j, nsplit, count=0;
+    PyObject *list, *sub;
 
+    /* Count the splits first, so that the list is allocated only once. */
+    nsplit = 0;
+    if (maxcount > 0) {
+        nsplit = STRINGLIB(count_char)(str, str_len, ch, maxcount);
+    }
+#ifndef STRINGLIB_MUTABLE
+    if (nsplit == 0 && STRINGLIB_CHECK_EXACT(str_obj)) {
+        /* ch not in str_obj, so just use str_obj as list[0] */
+        list = PyList_New(1);
+        if (list == NULL)
+            return NULL;
+        Py_INCREF(str_obj);
+        PyList_SET_ITEM(list, 0, (PyObject *)str_obj);
+        return list;
+    }
+#endif
+    list = PyList_New(nsplit + 1);
     if (list == NULL)
         return NULL;
 
+#define SPLIT_SET(data, left, right) {          \
+    sub = STRINGLIB_NEW((data) + (left),        \
+                        (right) - (left));      \
+    if (sub == NULL)                            \
+        goto onError;                           \
+    PyList_SET_ITEM(list, count, sub);          \
+    count++; }
+
     i = j = 0;
-    while ((j < str_len) && (maxcount-- > 0)) {
-        for(; j < str_len; j++) {
-            /* I found that using memchr makes no difference */
-            if (str[j] == ch) {
-                SPLIT_ADD(str, i, j);
-                i = j = j + 1;
-                break;
-            }
+#ifdef _Py_HAVE_SSE2
+    /* Walk the matches of each block of 16 characters. */
+    const __m128i splat = STRINGLIB(_splat)(ch);
+    for (; count < nsplit && str_len - j >= 16; j += 16) {
+        uint32_t mask = _mm_movemask_epi8(STRINGLIB(_eq16)(str + j, splat));
+        while (mask && count < nsplit) {
+            Py_ssize_t k = j + _Py_ctz32(mask);
+            mask &= mask - 1;
+            SPLIT_SET(str, i, k);
+            i = k + 1;
         }
     }
-#ifndef STRINGLIB_MUTABLE
-    if (count == 0 && STRINGLIB_CHECK_EXACT(str_obj)) {
-        /* ch not in str_obj, so just use str_obj as list[0] */
-        Py_INCREF(str_obj);
-        PyList_SET_ITEM(list, 0, (PyObject *)str_obj);
-        count++;
-    } else
 #endif
-    if (i <= str_len) {
-        SPLIT_ADD(str, i, str_len);
+    for (; count < nsplit; j++) {
+        if (str[j] == ch) {
+            SPLIT_SET(str, i, j);
+            i = j + 1;
+        }
     }
-    FIX_PREALLOC_SIZE(list);
+    SPLIT_SET(str, i, str_len);
+#undef SPLIT_SET
     return list;
 
   onError:
@@ -357,6 +499,16 @@ STRINGLIB(splitlines)(PyObject* str_obj,
         Py_ssize_t eol;
 
         /* Find a line and append it */
+#ifdef _Py_HAVE_SSE2
+        while (str_len - i >= 16) {
+            uint32_t mask = STRINGLIB(_linebreak_mask16)(str + i);
+            if (mask) {
+                i += _Py_ctz32(mask);
+                break;
+            }
+            i += 16;
+        }
+#endif
         while (i < str_len && !STRINGLIB_ISLINEBREAK(str[i]))
             i++;
 
@@ -42,6 +42,7 @@ OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "Python.h"
 #include "pycore_abstract.h"      // _PyIndex_Check()
 #include "pycore_atomic_funcs.h"  // _Py_atomic_size_get()
+#include "pycore_bitutils.h"      // _Py_ctz32()
 #include "pycore_bytes_methods.h" // _Py_bytes_lower()
 #include "pycore_format.h"        // F_LJUST
 #include "pycore_initconfig.h"    // _PyStatus_OK()
@@ -50,6 +51,7 @@ OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "pycore_pathconfig.h"    // _Py_DumpPathConfig()
 #include "pycore_pylifecycle.h"   // _Py_SetFileSystemEncoding()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
+#include "pycore_simd.h"          // _Py_HAVE_SSE2
 #include "pycore_ucnhash.h"       // _PyUnicode_Name_CAPI
 #include "stringlib/eq.h"         // unicode_eq()
 
@@ -5079,6 +5081,26 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
 {
     const char *p = start;
 
+#ifdef _Py_HAVE_SSE2
+    /* Copy 16 bytes at a time; the bytes stored past the first non-ASCII
+       byte are overwritten later or lie beyond the end of the result. */
+    Py_UCS1 *q = dest;
+    while (end - p >= 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)p);
+        _mm_storeu_si128((__m128i *)q, chunk);
+        int mask = _mm_movemask_epi8(chunk);
+        if (mask) {
+            p += _Py_ctz32(mask);
+            return p - start;
+        }
+        p += 16;
+        q += 16;
+    }
+    while (p < end && !((unsigned char)*p & 0x80)) {
+        *q++ = *p++;
+    }
+    return p - start;
+#else
 #if SIZEOF_SIZE_T <= SIZEOF_VOID_P
     assert(_Py_IS_ALIGNED(dest, ALIGNOF_SIZE_T));
     if (_Py_IS_ALIGNED(p, ALIGNOF_SIZE_T)) {
@@ -5126,6 +5148,98 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
     }
     memcpy(dest, start, p - start);
     return p - start;
+#endif /* _Py_HAVE_SSE2 */
+}
+
+/* Return the number of characters of the UTF-8 data [s, end), and set
+   *maxbyte to its largest byte.  If the data is valid UTF-8, the largest
+   byte tells how wide the characters are: below 0xC4 all of them are in
+   Latin-1, below 0xF0 all of them are in the BMP. */
+static Py_ssize_t
+utf8_count_chars(const char *s, const char *end, unsigned char *maxbyte)
+{
+    Py_ssize_t ncont = 0;  /* number of continuation bytes */
+    Py_ssize_t size = end - s;
+    unsigned char max = 0;
+
+#ifdef _Py_HAVE_SSE2
+    /* Continuation bytes 0x80-0xBF are the signed bytes below -64.  Count
+       them in 8-bit lanes, flushing the counters every 255 blocks. */
+    const __m128i cont_limit = _mm_set1_epi8((char)0xC0);
+    __m128i vmax = _mm_setzero_si128();
+    while (end - s >= 16) {
+        Py_ssize_t nblocks = Py_MIN((end - s) / 16, 255);
+        __m128i counts = _mm_setzero_si128();
+        for (; nblocks > 0; nblocks--, s += 16) {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)s);
+            vmax = _mm_max_epu8(vmax, chunk);
+            counts = _mm_sub_epi8(counts, _mm_cmplt_epi8(chunk, cont_limit));
+        }
+        counts = _mm_sad_epu8(counts, _mm_setzero_si128());
+        ncont += _mm_cvtsi128_si32(counts) + _mm_extract_epi16(counts, 4);
+    }
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 8));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 4));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 2));
+    vmax = _mm_max_epu8(vmax, _mm_srli_si128(vmax, 1));
+    max = (unsigned char)_mm_cvtsi128_si32(vmax);
+#endif
+    for (; s < end; s++) {
+        unsigned char ch = (unsigned char)*s;
+        ncont += IS_CONTINUATION_BYTE(ch);
+        if (ch > max) {
+            max = ch;
+        }
+    }
+    *maxbyte = max;
+    return size - ncont;
+}
+
+/* Decode the UTF-8 data [s, end) into a new string of the exact kind and
+   length found by utf8_count_chars(), after the ASCII prefix already
+   decoded into the first `prefix` characters of `ascii`.  Return NULL
+   without an exception set if the data is not valid UTF-8. */
+static PyObject *
+utf8_decode_exact(const char *s, const char *end,
+                  PyObject *ascii, Py_ssize_t prefix)
+{
+    unsigned char maxbyte;
+    Py_ssize_t length = prefix + utf8_count_chars(s, end, &maxbyte);
+    Py_UCS4 maxchar = maxbyte >= 0xF0 ? MAX_UNICODE :
+                      maxbyte >= 0xC4 ? 0xFFFF : 0xFF;
+    const Py_UCS1 *src = PyUnicode_1BYTE_DATA(ascii);
+    Py_ssize_t pos = prefix;
+    Py_UCS4 ch;
+
+    PyObject *u = PyUnicode_New(length, maxchar);
+    if (u == NULL) {
+        return NULL;
+    }
+    switch (PyUnicode_KIND(u)) {
+    case PyUnicode_1BYTE_KIND:
+        memcpy(PyUnicode_1BYTE_DATA(u), src, prefix);
+        ch = ucs1lib_utf8_decode(&s, end, PyUnicode_1BYTE_DATA(u), &pos);
+        break;
+    case PyUnicode_2BYTE_KIND:
+        _PyUnicode_CONVERT_BYTES(Py_UCS1, Py_UCS2, src, src + prefix,
+                                 PyUnicode_2BYTE_DATA(u));
+        ch = ucs2lib_utf8_decode(&s, end, PyUnicode_2BYTE_DATA(u), &pos);
+        break;
+    default:
+        _PyUnicode_CONVERT_BYTES(Py_UCS1, Py_UCS4, src, src + prefix,
+                                 PyUnicode_4BYTE_DATA(u));
+        ch = ucs4lib_utf8_decode(&s, end, PyUnicode_4BYTE_DATA(u), &pos);
+        break;
+    }
+    if (ch != 0 || s != end) {
+        /* Invalid data, or a character wider than the largest byte
+           implied; leave it to the general decoder. */
+        Py_DECREF(u);
+        return NULL;
+    }
+    assert(pos == length);
+    assert(_PyUnicode_CheckConsistency(u, 1));
+    return u;
 }
 
 static PyObject *
@@ -5160,6 +5274,20 @@ unicode_decode_utf8(const char *s, Py_ssize_t size,
         return u;
     }
 
+    // Size the result from a scan of the rest and decode straight into it.
+    PyObject *exact = utf8_decode_exact(s, end, u, s - starts);
+    if (exact != NULL) {
+        Py_DECREF(u);
+        if (consumed) {
+            *consumed = size;
+        }
+        return exact;
+    }
+    if (PyErr_Occurred()) {
+        Py_DECREF(u);
+        return NULL;
+    }
+
     // Use _PyUnicodeWriter after fast path is failed.
     _PyUnicodeWriter writer;
     _PyUnicodeWriter_InitWithBuffer(&writer, u);
@@ -2825,6 +2825,34 @@ zip_next(zipobject *lz)
     return NULL;
 }
 
+static PyObject *
+zip_length_hint(zipobject *lz, PyObject *Py_UNUSED(ignored))
+{
+    /* Only report a length if it is known for every argument: the shortest
+       one is then an upper bound.  Otherwise an unsized argument may be much
+       shorter than the others, and consumers like list() would overallocate. */
+    Py_ssize_t tuplesize = lz->tuplesize;
+    Py_ssize_t len = PY_SSIZE_T_MAX;
+    for (Py_ssize_t i = 0; i < tuplesize; i++) {
+        PyObject *it = PyTuple_GET_ITEM(lz->ittuple, i);
+        /* -2 is not a valid length: it tells that the length is unknown */
+        Py_ssize_t n = PyObject_LengthHint(it, -2);
+        if (n == -1) {
+            return NULL;
+        }
+        if (n == -2) {
+            Py_RETURN_NOTIMPLEMENTED;
+        }
+        len = Py_MIN(len, n);
+    }
+    if (tuplesize == 0) {
+        len = 0;
+    }
+    return PyLong_FromSsize_t(len);
+}
+
+PyDoc_STRVAR(length_hint_doc, "Private method returning an estimate of len(list(it)).");
+
 static PyObject *
 zip_reduce(zipobject *lz, PyObject *Py_UNUSED(ignored))
 {
@@ -2849,6 +2877,7 @@ zip_setstate(zipobject *lz, PyObject *state)
 }
 
 static PyMethodDef zip_methods[] = {
+    {"__length_hint__", (PyCFunction)zip_length_hint, METH_NOARGS, length_hint_doc},
     {"__reduce__",   (PyCFunction)zip_reduce,   METH_NOARGS, reduce_doc},
     {"__setstate__", (PyCFunction)zip_setstate, METH_O,      setstate_doc},
     {NULL}  /* sentinel */
@@ -1,9 +1,46 @@
 /* bytes to hex implementation */
 
 #include "Python.h"
+#include "pycore_simd.h"          // _Py_in_range_epi8()
 
 #include "pystrhex.h"
 
+#ifdef _Py_HAVE_SSE2
+/* Return the lowercase hex digits of 16 nibbles. */
+static inline __m128i
+_nibbles_to_hex(__m128i nibbles)
+{
+    __m128i letters = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+                        _mm_and_si128(letters, _mm_set1_epi8('a' - '0' - 10)));
+}
+#endif
+
+/* Write the 2*len hex digits of src to dst. */
+static inline void
+hexlify(const unsigned char *src, Py_ssize_t len, Py_UCS1 *dst)
+{
+    Py_ssize_t i = 0;
+#ifdef _Py_HAVE_SSE2
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    for (; len - i >= 16; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+        __m128i low = _mm_and_si128(bytes, mask);
+        _mm_storeu_si128((__m128i *)dst,
+                         _nibbles_to_hex(_mm_unpacklo_epi8(high, low)));
+        _mm_storeu_si128((__m128i *)(dst + 16),
+                         _nibbles_to_hex(_mm_unpackhi_epi8(high, low)));
+        dst += 32;
+    }
+#endif
+    for (; i < len; i++) {
+        unsigned char c = src[i];
+        *dst++ = Py_hexdigits[c >> 4];
+        *dst++ = Py_hexdigits[c & 0x0f];
+    }
+}
+
 static PyObject *_Py_strhex_impl(const char* argbuf, const Py_ssize_t arglen,
                                  const PyObject* sep, int bytes_per_sep_group,
                                  const int return_bytes)
@@ -81,59 +118,33 @@ static PyObject *_Py_strhex_impl(const char* argbuf, const Py_ssize_t arglen,
     }
 
     /* Hexlify */
-    Py_ssize_t i, j;
-    unsigned char c;
-
+    const unsigned char *src = (const unsigned char *)argbuf;
     if (bytes_per_sep_group == 0) {
-        for (i = j = 0; i < arglen; ++i) {
-            assert((j + 1) < resultlen);
-            c = argbuf[i];
-            retbuf[j++] = Py_hexdigits[c >> 4];
-            retbuf[j++] = Py_hexdigits[c & 0x0f];
-        }
-        assert(j == resultlen);
+        hexlify(src, arglen, retbuf);
     }
     else {
         /* The number of complete chunk+sep periods */
         Py_ssize_t chunks = (arglen - 1) / abs_bytes_per_sep;
+        /* Groups count from the right if bytes_per_sep_group > 0, so the
+           partial group (if any) comes first; otherwise it comes last. */
+        Py_ssize_t first = bytes_per_sep_group < 0 ?
+            abs_bytes_per_sep : arglen - chunks * abs_bytes_per_sep;
+        Py_ssize_t last = arglen - first - (chunks - 1) * abs_bytes_per_sep;
         Py_ssize_t chunk;
-        unsigned int k;
-
-        if (bytes_per_sep_group < 0) {
-            i = j = 0;
-            for (chunk = 0; chunk < chunks; chunk++) {
-                for (k = 0; k < abs_bytes_per_sep; k++) {
-                    c = argbuf[i++];
-                    retbuf[j++] = Py_hexdigits[c >> 4];
-                    retbuf[j++] = Py_hexdigits[c & 0x0f];
-                }
-                retbuf[j++] = sep_char;
-            }
-            while (i < arglen) {
-                c = argbuf[i++];
-                retbuf[j++] = Py_hexdigits[c >> 4];
-                retbuf[j++] = Py_hexdigits[c & 0x0f];
-            }
-            assert(j == resultlen);
-        }
-        else {
-            i = arglen - 1;
-            j = resultlen - 1;
-            for (chunk = 0; chunk < chunks; chunk++) {
-                for (k = 0; k < abs_bytes_per_sep; k++) {
-                    c = argbuf[i--];
-                    retbuf[j--] = Py_hexdigits[c & 0x0f];
-                    retbuf[j--] = Py_hexdigits[c >> 4];
-                }
-                retbuf[j--] = sep_char;
-            }
-            while (i >= 0) {
-                c = argbuf[i--];
-                retbuf[j--] = Py_hexdigits[c & 0x0f];
-                retbuf[j--] = Py_hexdigits[c >> 4];
-            }
-            assert(j == -1);
+
+        hexlify(src, first, retbuf);
+        src += first;
+        retbuf += 2 * first;
+        for (chunk = 1; chunk < chunks; chunk++) {
+            *retbuf++ = sep_char;
+            hexlify(src, abs_bytes_per_sep, retbuf);
+            src += abs_bytes_per_sep;
+            retbuf += 2 * abs_bytes_per_sep;
         }
+        *retbuf++ = sep_char;
+        hexlify(src, last, retbuf);
+        src += last;
+        assert(src == (const unsigned char *)argbuf + arglen);
     }
 
 #ifdef Py_DEBUG
@@ -170,3 +181,64 @@ PyObject * _Py_strhex_bytes_with_sep(const char* argbuf, const Py_ssize_t arglen
 {
     return _Py_strhex_impl(argbuf, arglen, sep, bytes_per_group, 1);
 }
+
+/* Decode pairs of hex digits from argbuf into retbuf, one byte per pair,
+ * until the end of argbuf or the first pair that is not two hex digits.
+ * Return the number of hex digits consumed, which is even; a trailing odd
+ * digit is not consumed. */
+Py_ssize_t _Py_strunhex(const char* argbuf, const Py_ssize_t arglen, char* retbuf)
+{
+    const unsigned char *src = (const unsigned char *)argbuf;
+    unsigned char *dst = (unsigned char *)retbuf;
+    Py_ssize_t i = 0;
+
+    assert(arglen >= 0);
+#ifdef _Py_HAVE_SSE2
+    for (; arglen - i >= 32; i += 32) {
+        __m128i chars0 = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i chars1 = _mm_loadu_si128((const __m128i *)(src + i + 16));
+        __m128i lower0 = _mm_or_si128(chars0, _mm_set1_epi8(0x20));
+        __m128i lower1 = _mm_or_si128(chars1, _mm_set1_epi8(0x20));
+        __m128i digit0 = _Py_in_range_epi8(chars0, '0', '9');
+        __m128i digit1 = _Py_in_range_epi8(chars1, '0', '9');
+        __m128i alpha0 = _Py_in_range_epi8(lower0, 'a', 'f');
+        __m128i alpha1 = _Py_in_range_epi8(lower1, 'a', 'f');
+        if (_mm_movemask_epi8(_mm_and_si128(_mm_or_si128(digit0, alpha0),
+                                            _mm_or_si128(digit1, alpha1)))
+            != 0xFFFF) {
+            break;
+        }
+        /* Nibble values: c - '0' for digits, (c | 0x20) - 'a' + 10 for
+           letters. */
+        __m128i value0 = _mm_sub_epi8(
+            _mm_or_si128(_mm_and_si128(digit0, chars0),
+                         _mm_and_si128(alpha0, lower0)),
+            _mm_or_si128(_mm_and_si128(digit0, _mm_set1_epi8('0')),
+                         _mm_and_si128(alpha0, _mm_set1_epi8('a' - 10))));
+        __m128i value1 = _mm_sub_epi8(
+            _mm_or_si128(_mm_and_si128(digit1, chars1),
+                         _mm_and_si128(alpha1, lower1)),
+            _mm_or_si128(_mm_and_si128(digit1, _mm_set1_epi8('0')),
+                         _mm_and_si128(alpha1, _mm_set1_epi8('a' - 10))));
+        /* In each 16-bit lane the high nibble is the low byte: combine
+           them and pack the lanes back to bytes. */
+        __m128i byte0 = _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(value0, _mm_set1_epi16(0x00ff)), 4),
+            _mm_srli_epi16(value0, 8));
+        __m128i byte1 = _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(value1, _mm_set1_epi16(0x00ff)), 4),
+            _mm_srli_epi16(value1, 8));
+        _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(byte0, byte1));
+        dst += 16;
+    }
+#endif
+    for (; arglen - i >= 2; i += 2) {
+        unsigned int top = _PyLong_DigitValue[src[i]];
+        unsigned int bot = _PyLong_DigitValue[src[i + 1]];
+        if (top >= 16 || bot >= 16) {
+            break;
+        }
+        *dst++ = (unsigned char)((top << 4) + bot);
+    }
+    return i;
+}
@@ -1003,16 +1003,26 @@ format_float_short(double d, char format_code,
     char *p = NULL;
     Py_ssize_t bufsize = 0;
     char *digits, *digits_end;
+    char shortest[_Py_RYU_DIGITS_SIZE];
     int decpt_as_int, sign, exp_len, exp = 0, use_exp = 0;
     Py_ssize_t decpt, digits_len, vdigits_start, vdigits_end;
     _Py_SET_53BIT_PRECISION_HEADER;
 
-    /* _Py_dg_dtoa returns a digit string (no decimal point or exponent).
-       Must be matched by a call to _Py_dg_freedtoa. */
-    _Py_SET_53BIT_PRECISION_START;
-    digits = _Py_dg_dtoa(d, mode, precision, &decpt_as_int, &sign,
-                         &digits_end);
-    _Py_SET_53BIT_PRECISION_END;
+    if (mode == 0 && Py_IS_FINITE(d)) {
+        /* The shortest repr; Ryu gives the same digits as Gay's mode 0
+           without big integer arithmetic. */
+        digits = shortest;
+        digits_end = digits + _Py_ryu_shortest(d, digits, &decpt_as_int,
+                                               &sign);
+    }
+    else {
+        /* _Py_dg_dtoa returns a digit string (no decimal point or
+           exponent).  Must be matched by a call to _Py_dg_freedtoa. */
+        _Py_SET_53BIT_PRECISION_START;
+        digits = _Py_dg_dtoa(d, mode, precision, &decpt_as_int, &sign,
+                             &digits_end);
+        _Py_SET_53BIT_PRECISION_END;
+    }
 
     decpt = (Py_ssize_t)decpt_as_int;
     if (digits == NULL) {
@@ -1233,7 +1243,7 @@ format_float_short(double d, char format_code,
            memory that isn't ours. But it's an okay debugging test. */
         assert(p-buf < bufsize);
     }
-    if (digits)
+    if (digits && digits != shortest)
         _Py_dg_freedtoa(digits);
 
     return buf;
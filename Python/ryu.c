@@ -0,0 +1,283 @@
+/* Shortest round-trip digits of a double, using Ulf Adams' Ryu algorithm:
+
+     Ulf Adams.  Ryu: fast float-to-string conversion.  PLDI 2018.
+
+   _Py_dg_dtoa() in mode 0 finds the shortest digit string that reads back
+   as the same double by running Steele & White / Gay's algorithm on big
+   integers.  Ryu produces exactly the same digits (the shortest string in
+   the rounding interval, and among those the one closest to the exact
+   value, ties to even) using only 64x128-bit products against a table of
+   powers of five, so repr() of a float does no memory allocation.
+
+   Only the digit generation lives here; format_float_short() in
+   Python/pystrtod.c still lays out the result. */
+
+#include "Python.h"
+#include "pycore_bitutils.h"     // _Py_umul128()
+#include "pycore_dtoa.h"
+
+/* Like dtoa.c, this relies on IEEE 754 binary64 doubles. */
+#ifndef PY_NO_SHORT_FLOAT_REPR
+
+#include "ryu_tables.h"
+
+#define DOUBLE_MANTISSA_BITS 52
+#define DOUBLE_EXPONENT_BITS 11
+#define DOUBLE_BIAS 1023
+
+/* floor(log2(5**e)) + 1, for 0 <= e <= 3528. */
+static inline int32_t
+pow5bits(int32_t e)
+{
+    assert(e >= 0 && e <= 3528);
+    return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+/* floor(log10(2**e)), for 0 <= e <= 1650. */
+static inline uint32_t
+log10_pow2(int32_t e)
+{
+    assert(e >= 0 && e <= 1650);
+    return ((uint32_t)e * 78913) >> 18;
+}
+
+/* floor(log10(5**e)), for 0 <= e <= 2620. */
+static inline uint32_t
+log10_pow5(int32_t e)
+{
+    assert(e >= 0 && e <= 2620);
+    return ((uint32_t)e * 732923) >> 20;
+}
+
+static inline uint32_t
+pow5_factor(uint64_t value)
+{
+    uint32_t count = 0;
+    assert(value != 0);
+    while (value % 5 == 0) {
+        value /= 5;
+        count++;
+    }
+    return count;
+}
+
+/* Return 1 if value is divisible by 5**p. */
+static inline int
+multiple_of_pow5(uint64_t value, uint32_t p)
+{
+    return pow5_factor(value) >= p;
+}
+
+/* Return 1 if value is divisible by 2**p. */
+static inline int
+multiple_of_pow2(uint64_t value, uint32_t p)
+{
+    assert(p < 64);
+    return (value & ((1ULL << p) - 1)) == 0;
+}
+
+/* Return (m * mul) >> j, where mul is a 128-bit table entry stored as
+   {low, high}, m has at most 55 bits and 64 < j < 128. */
+static inline uint64_t
+mul_shift64(uint64_t m, const uint64_t *mul, int32_t j)
+{
+    uint64_t high0, high1, low1, sum;
+    assert(j > 64 && j < 128);
+    (void)_Py_umul128(m, mul[0], &high0);
+    low1 = _Py_umul128(m, mul[1], &high1);
+    sum = high0 + low1;
+    if (sum < high0) {
+        high1++;
+    }
+    return (high1 << (128 - j)) | (sum >> (j - 64));
+}
+
+/* Find the shortest decimal representation of the double with the given
+   IEEE mantissa and biased exponent, which must not both be zero: set
+   *exponent and return the decimal mantissa. */
+static uint64_t
+shortest_decimal(uint64_t ieee_mantissa, uint32_t ieee_exponent,
+                 int32_t *exponent)
+{
+    int32_t e2, e10;
+    uint64_t m2, mv, vr, vp, vm, output;
+    uint32_t mm_shift;
+    int even, vm_is_trailing_zeros = 0, vr_is_trailing_zeros = 0;
+    int32_t removed = 0;
+    uint32_t last_removed_digit = 0;
+
+    /* Step 1: decode the double as m2 * 2**e2, with two extra bits of
+       room so that the halfway points to the neighbours are integers. */
+    if (ieee_exponent == 0) {
+        e2 = 1 - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS - 2;
+        m2 = ieee_mantissa;
+    }
+    else {
+        e2 = (int32_t)ieee_exponent - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS - 2;
+        m2 = (1ULL << DOUBLE_MANTISSA_BITS) | ieee_mantissa;
+    }
+    /* Round-half-even on input: the interval bounds belong to the
+       interval iff the mantissa is even. */
+    even = (m2 & 1) == 0;
+
+    /* Step 2: the interval of values that round to this double is
+       [mm, mp] * 2**e2 with mv = 4 * m2, mp = mv + 2 and mm = mv - 1 -
+       mm_shift; the lower gap is half as wide at a power of two. */
+    mv = 4 * m2;
+    mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+
+    /* Step 3: convert the interval to a decimal power base, computing
+       vr, vp, vm = floor(mv, mp, mm * 2**e2 / 10**e10), and whether the
+       dropped parts of vr and vm were all zero. */
+    if (e2 >= 0) {
+        const uint32_t q = log10_pow2(e2) - (e2 > 3);
+        const int32_t k = RYU_POW5_INV_BITCOUNT + pow5bits(q) - 1;
+        const int32_t i = -e2 + (int32_t)q + k;
+        const uint64_t *mul = ryu_pow5_inv_split[q];
+        e10 = (int32_t)q;
+        vr = mul_shift64(4 * m2, mul, i);
+        vp = mul_shift64(4 * m2 + 2, mul, i);
+        vm = mul_shift64(4 * m2 - 1 - mm_shift, mul, i);
+        if (q <= 21) {
+            /* At most one of mp, mv and mm is a multiple of 5. */
+            if (mv % 5 == 0) {
+                vr_is_trailing_zeros = multiple_of_pow5(mv, q);
+            }
+            else if (even) {
+                vm_is_trailing_zeros = multiple_of_pow5(mv - 1 - mm_shift, q);
+            }
+            else {
+                vp -= multiple_of_pow5(mv + 2, q);
+            }
+        }
+    }
+    else {
+        const uint32_t q = log10_pow5(-e2) - (-e2 > 1);
+        const int32_t i = -e2 - (int32_t)q;
+        const int32_t k = pow5bits(i) - RYU_POW5_BITCOUNT;
+        const int32_t j = (int32_t)q - k;
+        const uint64_t *mul = ryu_pow5_split[i];
+        e10 = (int32_t)q + e2;
+        vr = mul_shift64(4 * m2, mul, j);
+        vp = mul_shift64(4 * m2 + 2, mul, j);
+        vm = mul_shift64(4 * m2 - 1 - mm_shift, mul, j);
+        if (q <= 1) {
+            /* mv = 4 * m2 has at least two trailing zero bits, mm has one
+               iff mm_shift is 1 and mp = mv + 2 always has one. */
+            vr_is_trailing_zeros = 1;
+            if (even) {
+                vm_is_trailing_zeros = mm_shift == 1;
+            }
+            else {
+                vp--;
+            }
+        }
+        else if (q < 63) {
+            vr_is_trailing_zeros = multiple_of_pow2(mv, q);
+        }
+    }
+
+    /* Step 4: drop digits while the interval still holds a shorter
+       number, rounding vr to nearest. */
+    if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+        /* The rare general case: an interval bound may be exact, or the
+           exact value may sit halfway between two candidates. */
+        while (vp / 10 > vm / 10) {
+            vm_is_trailing_zeros &= vm % 10 == 0;
+            vr_is_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = (uint32_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vm_is_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_is_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = (uint32_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+            /* Exactly halfway: round to even. */
+            last_removed_digit = 4;
+        }
+        output = vr + ((vr == vm && (!even || !vm_is_trailing_zeros))
+                       || last_removed_digit >= 5);
+    }
+    else {
+        int round_up = 0;
+        if (vp / 100 > vm / 100) {
+            /* Usually at least two digits go; remove them at once. */
+            round_up = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10) {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || round_up);
+    }
+    *exponent = e10 + removed;
+    return output;
+}
+
+int
+_Py_ryu_shortest(double d, char *digits, int *decpt, int *sign)
+{
+    uint64_t bits, ieee_mantissa, output;
+    uint32_t ieee_exponent;
+    int32_t exponent;
+    char buf[20];
+    char *p;
+    int len;
+
+    memcpy(&bits, &d, sizeof(bits));
+#ifdef DOUBLE_IS_ARM_MIXED_ENDIAN_IEEE754
+    bits = (bits << 32) | (bits >> 32);
+#endif
+    *sign = (int)(bits >> 63);
+    ieee_mantissa = bits & ((1ULL << DOUBLE_MANTISSA_BITS) - 1);
+    ieee_exponent = (uint32_t)(bits >> DOUBLE_MANTISSA_BITS)
+                    & ((1U << DOUBLE_EXPONENT_BITS) - 1);
+    assert(ieee_exponent != (1U << DOUBLE_EXPONENT_BITS) - 1);
+
+    if (ieee_exponent == 0 && ieee_mantissa == 0) {
+        /* Zero: "0" with the decimal point after it, as in dtoa.c. */
+        digits[0] = '0';
+        digits[1] = '\0';
+        *decpt = 1;
+        return 1;
+    }
+
+    output = shortest_decimal(ieee_mantissa, ieee_exponent, &exponent);
+    assert(output != 0);
+
+    /* Trailing zeros belong in the exponent, not in the digits. */
+    while (output % 10 == 0) {
+        output /= 10;
+        exponent++;
+    }
+    p = buf + sizeof(buf);
+    do {
+        *--p = (char)('0' + output % 10);
+        output /= 10;
+    } while (output);
+    len = (int)(buf + sizeof(buf) - p);
+    assert(len < _Py_RYU_DIGITS_SIZE);
+    memcpy(digits, p, len);
+    digits[len] = '\0';
+    *decpt = exponent + len;
+    return len;
+}
+
+#endif  /* !PY_NO_SHORT_FLOAT_REPR */
@@ -0,0 +1,85 @@
+"""Compare the int multiplication algorithms across operand sizes.
+
+For each size, the top-level product of two random ints is computed with
+each algorithm of Objects/longobject.c (smaller products inside it use
+whatever k_mul() picks), and with the ``*`` operator.  Times are the best
+of several runs, in seconds per product.
+
+Requires a build with the _testinternalcapi module.
+
+    python Tools/longbench/longbench.py
+    python Tools/longbench/longbench.py --square 1000 10000 100000
+"""
+
+import argparse
+import random
+import sys
+import timeit
+
+try:
+    from _testinternalcapi import long_mul_with_algorithm
+except ImportError:
+    sys.exit("longbench requires the _testinternalcapi module")
+
+ALGORITHMS = ["school", "karatsuba", "toom3", "ntt"]
+DEFAULT_SIZES = [100, 300, 1000, 3000, 10000, 30000, 100000, 300000,
+                 1000000]
+
+
+def best_time(stmt, repeat):
+    timer = timeit.Timer(stmt)
+    number, _ = timer.autorange()
+    return min(timer.repeat(repeat, number)) / number
+
+
+def format_time(t):
+    if t is None:
+        return "-"
+    for unit, scale in (("s", 1), ("ms", 1e-3), ("us", 1e-6)):
+        if t >= scale:
+            return "%.3g %s" % (t / scale, unit)
+    return "%.3g ns" % (t / 1e-9)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("sizes", metavar="DIGITS", type=int, nargs="*",
+                        default=DEFAULT_SIZES,
+                        help="operand sizes, in decimal digits")
+    parser.add_argument("--square", action="store_true",
+                        help="time squares instead of products")
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="number of runs per measurement (default: 3)")
+    parser.add_argument("--max-school", type=int, default=30000,
+                        metavar="DIGITS",
+                        help="skip the school algorithm above this size "
+                             "(default: 30000)")
+    args = parser.parse_args()
+
+    random.seed(12345)
+    header = ["digits"] + ALGORITHMS + ["a*b"]
+    print("".join("%12s" % h for h in header))
+    for ndigits in args.sizes:
+        nbits = int(ndigits * 3.3219280948873626)
+        a = random.getrandbits(nbits) | (1 << (nbits - 1))
+        b = a if args.square else random.getrandbits(nbits) | (1 << (nbits - 1))
+        row = []
+        for algorithm, name in enumerate(ALGORITHMS):
+            if name == "school" and ndigits > args.max_school:
+                row.append(None)
+                continue
+            try:
+                long_mul_with_algorithm(a, b, algorithm)
+            except OverflowError:
+                row.append(None)
+                continue
+            row.append(best_time(
+                lambda: long_mul_with_algorithm(a, b, algorithm),
+                args.repeat))
+        row.append(best_time(lambda: a * b, args.repeat))
+        print("%12d" % ndigits + "".join("%12s" % format_time(t) for t in row))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
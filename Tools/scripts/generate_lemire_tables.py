@@ -0,0 +1,61 @@
+# This script generates Python/lemire_tables.h, the table of 128-bit
+# powers of five used by the Eisel-Lemire fast path of _Py_dg_strtod() in
+# Python/dtoa.c.
+
+import sys
+
+# Decimal exponents q for which w * 10**q can be a finite nonzero double
+# for some 64-bit w.
+MIN_POW10 = -342
+MAX_POW10 = 308
+
+header = """\
+/* Auto-generated by Tools/scripts/generate_lemire_tables.py */
+#ifndef Py_LEMIRE_TABLES_H
+#define Py_LEMIRE_TABLES_H
+
+#define LEMIRE_MIN_POW10 ({min})
+#define LEMIRE_MAX_POW10 {max}
+
+/* lemire_pow5[q - LEMIRE_MIN_POW10] holds the 128 most significant bits of
+   5**q as {{low, high}}: truncated for q >= 0, an upper bound of 1/5**-q
+   for q < 0. */
+static const uint64_t lemire_pow5[LEMIRE_MAX_POW10 - LEMIRE_MIN_POW10 + 1][2] = {{
+"""
+
+footer = """\
+};
+
+#endif /* !Py_LEMIRE_TABLES_H */
+"""
+
+
+def pow5_128(q):
+    if q >= 0:
+        power5 = 5**q
+        shift = power5.bit_length() - 128
+        return power5 >> shift if shift >= 0 else power5 << -shift
+    power5 = 5**-q
+    z = (power5 - 1).bit_length()
+    if q >= -27:
+        # 2**b / 5**-q has exactly 128 bits; 5**-q < 2**64 here.
+        return (1 << (z + 127)) // power5 + 1
+    value = (1 << (2 * z + 128)) // power5 + 1
+    return value >> (value.bit_length() - 128)
+
+
+def main(outfile='Python/lemire_tables.h'):
+    with open(outfile, 'w') as fobj:
+        fobj.write(header.format(min=MIN_POW10, max=MAX_POW10))
+        for q in range(MIN_POW10, MAX_POW10 + 1):
+            value = pow5_128(q)
+            assert value.bit_length() == 128
+            fobj.write("    {0x%016xULL, 0x%016xULL},\n"
+                       % (value & (2**64 - 1), value >> 64))
+        fobj.write(footer)
+
+    print("%s regenerated" % outfile)
+
+
+if __name__ == '__main__':
+    main(*sys.argv[1:])
@@ -0,0 +1,70 @@
+# This script generates Python/ryu_tables.h, the tables of 125-bit
+# powers of five used by the shortest float repr in Python/ryu.c.
+
+import sys
+
+# Number of significant bits kept for 5**i and for 2**k / 5**i.
+POW5_BITCOUNT = 125
+POW5_INV_BITCOUNT = 125
+
+# Largest exponents needed for IEEE 754 binary64 (see Python/ryu.c).
+POW5_TABLE_SIZE = 326
+POW5_INV_TABLE_SIZE = 342
+
+header = """\
+/* Auto-generated by Tools/scripts/generate_ryu_tables.py */
+#ifndef Py_RYU_TABLES_H
+#define Py_RYU_TABLES_H
+
+#define RYU_POW5_BITCOUNT {bits}
+#define RYU_POW5_INV_BITCOUNT {inv_bits}
+#define RYU_POW5_TABLE_SIZE {size}
+#define RYU_POW5_INV_TABLE_SIZE {inv_size}
+"""
+
+footer = """
+#endif /* !Py_RYU_TABLES_H */
+"""
+
+
+def write_table(fobj, name, size, values):
+    fobj.write("\nstatic const uint64_t %s[%s][2] = {\n" % (name, size))
+    for value in values:
+        fobj.write("    {0x%016xULL, 0x%016xULL},\n"
+                   % (value & (2**64 - 1), value >> 64))
+    fobj.write("};\n")
+
+
+def pow5_split(n):
+    # The top POW5_BITCOUNT bits of 5**i, rounded down.
+    for i in range(n):
+        pow5 = 5**i
+        shift = pow5.bit_length() - POW5_BITCOUNT
+        yield pow5 >> shift if shift >= 0 else pow5 << -shift
+
+
+def pow5_inv_split(n):
+    # 2**k / 5**i, rounded up, scaled to POW5_INV_BITCOUNT bits.
+    for i in range(n):
+        pow5 = 5**i
+        k = pow5.bit_length() - 1 + POW5_INV_BITCOUNT
+        yield (1 << k) // pow5 + 1
+
+
+def main(outfile='Python/ryu_tables.h'):
+    with open(outfile, 'w') as fobj:
+        fobj.write(header.format(bits=POW5_BITCOUNT,
+                                 inv_bits=POW5_INV_BITCOUNT,
+                                 size=POW5_TABLE_SIZE,
+                                 inv_size=POW5_INV_TABLE_SIZE))
+        write_table(fobj, "ryu_pow5_inv_split", "RYU_POW5_INV_TABLE_SIZE",
+                    pow5_inv_split(POW5_INV_TABLE_SIZE))
+        write_table(fobj, "ryu_pow5_split", "RYU_POW5_TABLE_SIZE",
+                    pow5_split(POW5_TABLE_SIZE))
+        fobj.write(footer)
+
+    print("%s regenerated" % outfile)
+
+
+if __name__ == '__main__':
+    main(*sys.argv[1:])
@@ -1019,7 +1019,8 @@ def detect_simple_extensions(self):
                            libraries=['m']))
 
         # CSV files
-        self.add(Extension('_csv', ['_csv.c']))
+        self.add(Extension('_csv', ['_csv.c'],
+                           extra_compile_args=['-DPy_BUILD_CORE_MODULE']))
 
         # POSIX subprocess module helper.
         self.add(Extension('_posixsubprocess', ['_posixsubprocess.c'],
@@ -1708,11 +1709,11 @@ def detect_compress_exts(self):
         # Helper module for various ascii-encoders.  Uses zlib for an optimized
         # crc32 if we have it.  Otherwise binascii uses its own.
         if have_zlib:
-            extra_compile_args = ['-DUSE_ZLIB_CRC32']
+            extra_compile_args = ['-DUSE_ZLIB_CRC32', '-DPy_BUILD_CORE_MODULE']
             libraries = ['z']
             extra_link_args = zlib_extra_link_args
         else:
-            extra_compile_args = []
+            extra_compile_args = ['-DPy_BUILD_CORE_MODULE']
             libraries = []
             extra_link_args = []
         self.add(Extension('binascii', ['binascii.c'],